@@ -7,6 +7,7 @@
 
 #include "lorenz95/BackgroundCheck.h"
 
+#include <cmath>
 #include <vector>
 
 #include "lorenz95/L95Traits.h"
@@ -29,23 +30,24 @@ void BackgroundCheck::postFilter(const GomL95 &,
                                  const ObsVec1D & hofx,
                                  const ObsVec1D &,
                                  const ObsDiags1D &) {
-  std::vector<float> yobs;
-  obsdb_.getdb("ObsValue", yobs);
+  const std::vector<double> & yobs = obsdb_.column("ObsValue");
+  // Only observations still passing QC are checked
+  std::vector<size_t> rejected;
   size_t inflate = 0;
-  size_t ireject = 0;
-  for (size_t jj = 0; jj < yobs.size(); ++jj) {
-    if (std::abs(yobs[jj] - hofx[jj]) > options_.threshold) {
+  for (const size_t jj : qcflags_->active()) {
+    if (std::abs(static_cast<float>(yobs[jj]) - hofx[jj]) > options_.threshold) {
       // inflate obs error variance
       if (options_.inflation.value() != boost::none) {
         (*obserr_)[jj] *= *options_.inflation.value();
         ++inflate;
       // or reject observation
       } else {
-        (*qcflags_)[jj] = 1;
-        ++ireject;
+        rejected.push_back(jj);
       }
     }
   }
+  qcflags_->reject(rejected, 1);
+  const size_t ireject = rejected.size();
   oops::Log::info() << "BackgroundCheck::postFilter rejected = " << ireject
                     << ", inflated = " << inflate << std::endl;
 }
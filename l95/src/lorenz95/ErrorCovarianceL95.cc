@@ -12,8 +12,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <vector>
 
 #include "eckit/config/Configuration.h"
+#include "eckit/exception/Exceptions.h"
+#include "lorenz95/FieldL95.h"
 #include "lorenz95/IncrementL95.h"
 #include "lorenz95/Resolution.h"
 #include "lorenz95/StateL95.h"
@@ -34,6 +37,7 @@ ErrorCovarianceL95::ErrorCovarianceL95(const Resolution & geom, const oops::Vari
   rscale_(1.0/params.lengthScale)
 {
 // Gaussian structure function
+  ASSERT(geom.npoints() <= FieldL95::maxGatherSize);
   resol_ = geom.npoints();
   size_ = resol_/2+1;
   std::vector<double> structFct(resol_);
@@ -55,36 +59,45 @@ ErrorCovarianceL95::~ErrorCovarianceL95() {}
 // -----------------------------------------------------------------------------
 void ErrorCovarianceL95::multiply(const IncrementL95 & dxin,
                                   IncrementL95 & dxout) const {
+  std::vector<double> xglb;
+  dxin.getField().allGather(xglb);
   std::vector<std::complex<double> > coefs(resol_);
-  fft_.fwd(coefs, dxin.asVector());
+  fft_.fwd(coefs, xglb);
   for (unsigned int jj = 0; jj < size_; ++jj) {
     coefs[jj] *= bcoefs_[jj];
   }
-  fft_.inv(dxout.asVector(), coefs);
+  fft_.inv(xglb, coefs);
+  dxout.getField().setGlobal(xglb);
   double var = sigmab_ * sigmab_;
   dxout *= var;
 }
 // -----------------------------------------------------------------------------
 void ErrorCovarianceL95::inverseMultiply(const IncrementL95 & dxin,
                                          IncrementL95 & dxout) const {
+  std::vector<double> xglb;
+  dxin.getField().allGather(xglb);
   std::vector<std::complex<double> > coefs(resol_);
-  fft_.fwd(coefs, dxin.asVector());
+  fft_.fwd(coefs, xglb);
   for (unsigned int jj = 0; jj < size_; ++jj) {
     coefs[jj] /= bcoefs_[jj];
   }
-  fft_.inv(dxout.asVector(), coefs);
+  fft_.inv(xglb, coefs);
+  dxout.getField().setGlobal(xglb);
   double vari = 1.0 / (sigmab_ * sigmab_);
   dxout *= vari;
 }
 // -----------------------------------------------------------------------------
 void ErrorCovarianceL95::randomize(IncrementL95 & dx) const {
   dx.random();
+  std::vector<double> xglb;
+  dx.getField().allGather(xglb);
   std::vector<std::complex<double> > coefs(resol_);
-  fft_.fwd(coefs, dx.asVector());
+  fft_.fwd(coefs, xglb);
   for (unsigned int jj = 0; jj < size_; ++jj) {
     coefs[jj] *= std::sqrt(bcoefs_[jj]);
   }
-  fft_.inv(dx.asVector(), coefs);
+  fft_.inv(xglb, coefs);
+  dx.getField().setGlobal(xglb);
   dx *= sigmab_;
 }
 // -----------------------------------------------------------------------------
@@ -51,6 +51,11 @@ class ErrorCovarianceL95Parameters : public oops::ModelSpaceCovarianceParameters
 /// Background error covariance matrix for Lorenz 95 model.
 /*!
  *  Gaussian background error covariance matrix for Lorenz 95 model.
+ *
+ *  The covariance is applied in spectral space and the transforms are not distributed:
+ *  every task gathers the whole field and does the same global FFT. The cost per task does
+ *  not decrease with the number of tasks, and the resolution is limited to
+ *  FieldL95::maxGatherSize gridpoints.
  */
 
 // -----------------------------------------------------------------------------
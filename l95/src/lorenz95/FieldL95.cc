@@ -10,10 +10,19 @@
 
 #include "lorenz95/FieldL95.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <limits>
 #include <string>
+#include <vector>
 
 #include "eckit/config/Configuration.h"
 #include "eckit/exception/Exceptions.h"
@@ -21,45 +30,71 @@
 #include "lorenz95/GomL95.h"
 #include "lorenz95/LocsL95.h"
 #include "lorenz95/Resolution.h"
+#include "oops/mpi/mpi.h"
 #include "oops/util/abor1_cpp.h"
+#include "oops/util/DateTime.h"
 #include "oops/util/Logger.h"
 #include "oops/util/Random.h"
 
 // -----------------------------------------------------------------------------
 namespace lorenz95 {
 // -----------------------------------------------------------------------------
+// Binary files start with a magic string, followed by the resolution, the date and
+// the variable names (strings are stored as length and characters), then the raw
+// values in native byte order.
+static const char binaryMagic[8] = {'L', '9', '5', 'B', 'I', 'N', '1', '\0'};
+// -----------------------------------------------------------------------------
+static void writeString(std::ofstream & fout, const std::string & str) {
+  const std::int64_t len = str.size();
+  fout.write(reinterpret_cast<const char *>(&len), sizeof(len));
+  fout.write(str.data(), len);
+}
+// -----------------------------------------------------------------------------
+static std::string readString(std::ifstream & fin) {
+  std::int64_t len = 0;
+  fin.read(reinterpret_cast<char *>(&len), sizeof(len));
+  if (!fin || len < 0 || len > 1024) ABORT("FieldL95::readBinary: corrupted header");
+  std::string str(len, ' ');
+  fin.read(&str[0], len);
+  return str;
+}
+// -----------------------------------------------------------------------------
 FieldL95::FieldL95(const Resolution & resol)
-  : resol_(resol.npoints()), x_(resol_)
+  : resol_(resol.npoints()), comm_(resol.getComm()), istart_(resol.istart()),
+    nlocal_(resol.nlocal()), x_(nlocal_)
 {
   ASSERT(resol_ > 0);
-  for (int jj = 0; jj < resol_; ++jj) x_[jj] = 0.0;
+  for (int jj = 0; jj < nlocal_; ++jj) x_[jj] = 0.0;
 }
 // -----------------------------------------------------------------------------
 FieldL95::FieldL95(const FieldL95 & other, const Resolution & resol)
-  : resol_(resol.npoints()), x_(resol_)
+  : resol_(resol.npoints()), comm_(resol.getComm()), istart_(resol.istart()),
+    nlocal_(resol.nlocal()), x_(nlocal_)
 {
   ASSERT(resol_ > 0);
   ASSERT(other.resol_ == resol_);
-  for (int jj = 0; jj < resol_; ++jj) x_[jj] = other.x_[jj];
+  ASSERT(other.nlocal_ == nlocal_);
+  for (int jj = 0; jj < nlocal_; ++jj) x_[jj] = other.x_[jj];
 }
 // -----------------------------------------------------------------------------
 FieldL95::FieldL95(const FieldL95 & other, const bool copy)
-  : resol_(other.resol_), x_(resol_)
+  : resol_(other.resol_), comm_(other.comm_), istart_(other.istart_),
+    nlocal_(other.nlocal_), x_(nlocal_)
 {
   ASSERT(resol_ > 0);
   if (copy) {
-    for (int jj = 0; jj < resol_; ++jj) x_[jj] = other.x_[jj];
+    for (int jj = 0; jj < nlocal_; ++jj) x_[jj] = other.x_[jj];
   } else {
-    for (int jj = 0; jj < resol_; ++jj) x_[jj] = 0.0;
+    for (int jj = 0; jj < nlocal_; ++jj) x_[jj] = 0.0;
   }
 }
 // -----------------------------------------------------------------------------
 void FieldL95::zero() {
-  for (int jj = 0; jj < resol_; ++jj) x_[jj] = 0.0;
+  for (int jj = 0; jj < nlocal_; ++jj) x_[jj] = 0.0;
 }
 // -----------------------------------------------------------------------------
 void FieldL95::ones() {
-  for (int jj = 0; jj < resol_; ++jj) x_[jj] = 1.0;
+  for (int jj = 0; jj < nlocal_; ++jj) x_[jj] = 1.0;
 }
 // -----------------------------------------------------------------------------
 void FieldL95::dirac(const FieldL95DiracParameters & parameters) {
@@ -73,101 +108,261 @@ void FieldL95::dirac(const FieldL95DiracParameters & parameters) {
   }
 
 // Setup Dirac
-  for (int jj = 0; jj < resol_; ++jj) x_[jj] = 0.0;
-  for (unsigned int jj = 0; jj < ixdir.size(); ++jj) x_[ixdir[jj]] = 1.0;
+  for (int jj = 0; jj < nlocal_; ++jj) x_[jj] = 0.0;
+  for (unsigned int jj = 0; jj < ixdir.size(); ++jj) {
+    const int ii = ixdir[jj] - istart_;
+    if (ii >= 0 && ii < nlocal_) x_[ii] = 1.0;
+  }
 }
 // -----------------------------------------------------------------------------
 void FieldL95::generate(const Field95GenerateParameters & parameters) {
-  for (int jj = 0; jj < resol_; ++jj) x_[jj] = 0.0;
+  for (int jj = 0; jj < nlocal_; ++jj) x_[jj] = 0.0;
   if (parameters.mean.value() != boost::none) {
     const double zz = *parameters.mean.value();
-    for (int jj = 0; jj < resol_; ++jj) x_[jj] = zz;
+    for (int jj = 0; jj < nlocal_; ++jj) x_[jj] = zz;
   }
   if (parameters.sinus.value() != boost::none) {
     const double zz = *parameters.sinus.value();
     const double pi = std::acos(-1.0);
     const double dx = 2.0 * pi / static_cast<double>(resol_);
-    for (int jj = 0; jj < resol_; ++jj) x_[jj] += zz * std::sin(static_cast<double>(jj) * dx);
+    for (int jj = 0; jj < nlocal_; ++jj) {
+      x_[jj] += zz * std::sin(static_cast<double>(istart_ + jj) * dx);
+    }
   }
   if (parameters.dirac.value() != boost::none) {
-    const int ii = *parameters.dirac.value();
-    x_[ii] += 1.0;
+    const int ii = *parameters.dirac.value() - istart_;
+    if (ii >= 0 && ii < nlocal_) x_[ii] += 1.0;
   }
-  oops::Log::trace() << "FieldL95::generate " << x_[28] << ", " << x_[29] << std::endl;
+  oops::Log::trace() << "FieldL95::generate done" << std::endl;
 }
 // -----------------------------------------------------------------------------
 FieldL95 & FieldL95::operator=(const FieldL95 & rhs) {
   ASSERT(rhs.resol_ == resol_);
-  for (int jj = 0; jj < resol_; ++jj) x_[jj] = rhs.x_[jj];
+  for (int jj = 0; jj < nlocal_; ++jj) x_[jj] = rhs.x_[jj];
   return *this;
 }
 // -----------------------------------------------------------------------------
 FieldL95 & FieldL95::operator+= (const FieldL95 & rhs) {
   ASSERT(rhs.resol_ == resol_);
-  for (int jj = 0; jj < resol_; ++jj) x_[jj] += rhs.x_[jj];
+  for (int jj = 0; jj < nlocal_; ++jj) x_[jj] += rhs.x_[jj];
   return *this;
 }
 // -----------------------------------------------------------------------------
 FieldL95 & FieldL95::operator-= (const FieldL95 & rhs) {
   ASSERT(rhs.resol_ == resol_);
-  for (int jj = 0; jj < resol_; ++jj) x_[jj] -= rhs.x_[jj];
+  for (int jj = 0; jj < nlocal_; ++jj) x_[jj] -= rhs.x_[jj];
   return *this;
 }
 // -----------------------------------------------------------------------------
 FieldL95 & FieldL95::operator*= (const double & fact) {
-  for (int jj = 0; jj < resol_; ++jj) x_[jj] *= fact;
+  for (int jj = 0; jj < nlocal_; ++jj) x_[jj] *= fact;
   return *this;
 }
 // -----------------------------------------------------------------------------
 void FieldL95::diff(const FieldL95 & x1, const FieldL95 & x2) {
   ASSERT(x1.resol_ == resol_);
   ASSERT(x2.resol_ == resol_);
-  for (int jj = 0; jj < resol_; ++jj) {
+  for (int jj = 0; jj < nlocal_; ++jj) {
     x_[jj] = x1.x_[jj] - x2.x_[jj];
   }
 }
 // -----------------------------------------------------------------------------
 void FieldL95::axpy(const double & zz, const FieldL95 & rhs) {
   ASSERT(rhs.resol_ == resol_);
-  for (int jj = 0; jj < resol_; ++jj) x_[jj] += zz * rhs.x_[jj];
+  for (int jj = 0; jj < nlocal_; ++jj) x_[jj] += zz * rhs.x_[jj];
 }
 // -----------------------------------------------------------------------------
 double FieldL95::dot_product_with(const FieldL95 & other) const {
   ASSERT(other.resol_ == resol_);
   double zz = 0.0;
-  for (int jj = 0; jj < resol_; ++jj) zz += x_[jj] * other.x_[jj];
+  for (int jj = 0; jj < nlocal_; ++jj) zz += x_[jj] * other.x_[jj];
+  comm_.allReduceInPlace(zz, eckit::mpi::Operation::SUM);
   return zz;
 }
 // -----------------------------------------------------------------------------
 void FieldL95::schur(const FieldL95 & rhs) {
   ASSERT(rhs.resol_ == resol_);
-  for (int jj = 0; jj < resol_; ++jj) x_[jj] *= rhs.x_[jj];
+  for (int jj = 0; jj < nlocal_; ++jj) x_[jj] *= rhs.x_[jj];
 }
 // -----------------------------------------------------------------------------
 void FieldL95::random() {
   util::NormalDistribution<double> xx(resol_, 0.0, 1.0, 1);
-  for (int jj = 0; jj < resol_; ++jj) x_[jj] = xx[jj];
+  for (int jj = 0; jj < nlocal_; ++jj) x_[jj] = xx[istart_ + jj];
 }
 // -----------------------------------------------------------------------------
 void FieldL95::read(std::ifstream & fin) {
+// Every task reads the whole file and keeps its own block
   fin.precision(std::numeric_limits<double>::digits10);
-  for (int jj = 0; jj < resol_; ++jj) fin >> x_[jj];
+  double zz;
+  for (int jj = 0; jj < resol_; ++jj) {
+    fin >> zz;
+    if (jj >= istart_ && jj < istart_ + nlocal_) x_[jj - istart_] = zz;
+  }
 }
 // -----------------------------------------------------------------------------
 void FieldL95::write(std::ofstream & fout) const {
-  fout.precision(std::numeric_limits<double>::digits10);
-  for (int jj = 0; jj < resol_; ++jj) fout << x_[jj] << " ";
+// Collective: the field is gathered and written by task 0 only
+  std::vector<double> zz;
+  oops::mpi::gather(comm_, x_, zz, 0);
+  if (comm_.rank() == 0) {
+    fout.precision(std::numeric_limits<double>::digits10);
+    for (int jj = 0; jj < resol_; ++jj) fout << zz[jj] << " ";
+  }
+}
+// -----------------------------------------------------------------------------
+bool FieldL95::isBinary(const std::string & filename) {
+  std::ifstream fin(filename.c_str(), std::ios::binary);
+  char magic[sizeof(binaryMagic)];
+  fin.read(magic, sizeof(magic));
+  return fin && std::memcmp(magic, binaryMagic, sizeof(magic)) == 0;
+}
+// -----------------------------------------------------------------------------
+void FieldL95::readBinary(const std::string & filename, util::DateTime & date,
+                          const bool mmap) {
+// Every task reads the header and its own block of values
+  std::ifstream fin(filename.c_str(), std::ios::binary);
+  if (!fin.is_open()) ABORT("FieldL95::readBinary: Error opening file: " + filename);
+  char magic[sizeof(binaryMagic)];
+  fin.read(magic, sizeof(magic));
+  if (!fin || std::memcmp(magic, binaryMagic, sizeof(magic)) != 0) {
+    ABORT("FieldL95::readBinary: not an L95 binary file: " + filename);
+  }
+  std::int64_t resol = 0;
+  fin.read(reinterpret_cast<char *>(&resol), sizeof(resol));
+  ASSERT(resol == resol_);
+  date = util::DateTime(readString(fin));
+  std::int64_t nvars = 0;
+  fin.read(reinterpret_cast<char *>(&nvars), sizeof(nvars));
+  ASSERT(nvars == 1);
+  const std::string var = readString(fin);
+  ASSERT(var == "x");
+  if (!fin) ABORT("FieldL95::readBinary: corrupted header in " + filename);
+  const std::streamoff header = fin.tellg();
+  const std::streamoff offset = header + istart_ * static_cast<std::streamoff>(sizeof(double));
+  const size_t nbytes = nlocal_ * sizeof(double);
+
+  if (mmap) {
+    fin.close();
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) ABORT("FieldL95::readBinary: Error opening file: " + filename);
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || st.st_size < offset + static_cast<std::streamoff>(nbytes)) {
+      ::close(fd);
+      ABORT("FieldL95::readBinary: file too short: " + filename);
+    }
+    void * addr = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED) ABORT("FieldL95::readBinary: mmap failed for " + filename);
+    std::memcpy(x_.data(), static_cast<const char *>(addr) + offset, nbytes);
+    ::munmap(addr, st.st_size);
+  } else {
+    fin.seekg(offset);
+    fin.read(reinterpret_cast<char *>(x_.data()), nbytes);
+    if (!fin) ABORT("FieldL95::readBinary: Error reading values from " + filename);
+  }
+}
+// -----------------------------------------------------------------------------
+void FieldL95::writeBinary(const std::string & filename, const util::DateTime & date) const {
+// Collective: the field is gathered and written by task 0 only
+  std::vector<double> zz;
+  oops::mpi::gather(comm_, x_, zz, 0);
+  if (comm_.rank() == 0) {
+    std::ofstream fout(filename.c_str(), std::ios::binary);
+    if (!fout.is_open()) ABORT("FieldL95::writeBinary: Error opening file: " + filename);
+    fout.write(binaryMagic, sizeof(binaryMagic));
+    const std::int64_t resol = resol_;
+    fout.write(reinterpret_cast<const char *>(&resol), sizeof(resol));
+    writeString(fout, date.toString());
+    const std::int64_t nvars = 1;
+    fout.write(reinterpret_cast<const char *>(&nvars), sizeof(nvars));
+    writeString(fout, "x");
+    fout.write(reinterpret_cast<const char *>(zz.data()), resol_ * sizeof(double));
+    if (!fout) ABORT("FieldL95::writeBinary: Error writing file: " + filename);
+  }
 }
 // -----------------------------------------------------------------------------
 double FieldL95::rms() const {
   double zz = 0.0;
-  for (int jj = 0; jj < resol_; ++jj) zz += x_[jj] * x_[jj];
+  for (int jj = 0; jj < nlocal_; ++jj) zz += x_[jj] * x_[jj];
+  comm_.allReduceInPlace(zz, eckit::mpi::Operation::SUM);
   zz = sqrt(zz/resol_);
   return zz;
 }
 // -----------------------------------------------------------------------------
+void FieldL95::extend(std::vector<double> & ext, const int west, const int east) const {
+// Copy local values into ext with west and east halo points from neighbouring tasks
+  ext.resize(west + nlocal_ + east);
+  for (int jj = 0; jj < nlocal_; ++jj) ext[west + jj] = x_[jj];
+  this->haloExchange(ext, 1, west, east);
+}
+// -----------------------------------------------------------------------------
+void FieldL95::haloExchange(std::vector<double> & ext, const size_t nm,
+                            const int west, const int east) const {
+// Gridpoint jj of the extended buffer holds nm values, starting at ext[jj*nm]
+  ASSERT(ext.size() == (west + nlocal_ + east) * nm);
+  const size_t nwest = west * nm;
+  const size_t neast = east * nm;
+  double * local = ext.data() + nwest;
+  const size_t ntasks = comm_.size();
+  if (ntasks == 1) {
+    for (size_t jj = 0; jj < nwest; ++jj) ext[jj] = local[(nlocal_ - west) * nm + jj];
+    for (size_t jj = 0; jj < neast; ++jj) local[nlocal_ * nm + jj] = local[jj];
+  } else {
+    ASSERT(west <= nlocal_ && east <= nlocal_);
+    const size_t myrank = comm_.rank();
+    const size_t iwest = (myrank + ntasks - 1) % ntasks;
+    const size_t ieast = (myrank + 1) % ntasks;
+    std::vector<eckit::mpi::Request> reqs;
+    reqs.push_back(comm_.iReceive(ext.data(), nwest, iwest, 1));
+    reqs.push_back(comm_.iReceive(local + nlocal_ * nm, neast, ieast, 2));
+    reqs.push_back(comm_.iSend(local + (nlocal_ - west) * nm, nwest, ieast, 1));
+    reqs.push_back(comm_.iSend(local, neast, iwest, 2));
+    for (size_t jr = 0; jr < reqs.size(); ++jr) comm_.wait(reqs[jr]);
+  }
+}
+// -----------------------------------------------------------------------------
+void FieldL95::extendAD(const std::vector<double> & ext, const int west, const int east) {
+// Adjoint of extend: halo contributions are added back to their owning task
+  ASSERT(ext.size() == static_cast<size_t>(west + nlocal_ + east));
+  for (int jj = 0; jj < nlocal_; ++jj) x_[jj] += ext[west + jj];
+  const size_t ntasks = comm_.size();
+  if (ntasks == 1) {
+    for (int jj = 0; jj < west; ++jj) x_[nlocal_ - west + jj] += ext[jj];
+    for (int jj = 0; jj < east; ++jj) x_[jj] += ext[west + nlocal_ + jj];
+  } else {
+    ASSERT(west <= nlocal_ && east <= nlocal_);
+    const size_t myrank = comm_.rank();
+    const size_t iwest = (myrank + ntasks - 1) % ntasks;
+    const size_t ieast = (myrank + 1) % ntasks;
+    std::vector<double> fromeast(west);
+    std::vector<double> fromwest(east);
+    std::vector<eckit::mpi::Request> reqs;
+    reqs.push_back(comm_.iReceive(fromeast.data(), west, ieast, 1));
+    reqs.push_back(comm_.iReceive(fromwest.data(), east, iwest, 2));
+    reqs.push_back(comm_.iSend(ext.data(), west, iwest, 1));
+    reqs.push_back(comm_.iSend(ext.data() + west + nlocal_, east, ieast, 2));
+    for (size_t jr = 0; jr < reqs.size(); ++jr) comm_.wait(reqs[jr]);
+    for (int jj = 0; jj < west; ++jj) x_[nlocal_ - west + jj] += fromeast[jj];
+    for (int jj = 0; jj < east; ++jj) x_[jj] += fromwest[jj];
+  }
+}
+// -----------------------------------------------------------------------------
+void FieldL95::allGather(std::vector<double> & global) const {
+  if (comm_.size() == 1) {
+    global = x_;
+  } else {
+    oops::mpi::allGatherv(comm_, x_, global);
+  }
+  ASSERT(global.size() == static_cast<size_t>(resol_));
+}
+// -----------------------------------------------------------------------------
+void FieldL95::setGlobal(const std::vector<double> & global) {
+  ASSERT(global.size() == static_cast<size_t>(resol_));
+  for (int jj = 0; jj < nlocal_; ++jj) x_[jj] = global[istart_ + jj];
+}
+// -----------------------------------------------------------------------------
 size_t FieldL95::serialSize() const {
-  return resol_;
+  return nlocal_;
 }
 // -----------------------------------------------------------------------------
 void FieldL95::serialize(std::vector<double> & vect) const {
@@ -175,22 +370,25 @@ void FieldL95::serialize(std::vector<double> & vect) const {
 }
 // -----------------------------------------------------------------------------
 void FieldL95::deserialize(const std::vector<double> & vect, size_t & index) {
-  for (int ii = 0; ii < resol_; ++ii) {
+  for (int ii = 0; ii < nlocal_; ++ii) {
     x_[ii] = vect[index];
     ++index;
   }
 }
 // -----------------------------------------------------------------------------
 void FieldL95::print(std::ostream & os) const {
+// Statistics of the local points only: printing does not communicate, so that it can be
+// done on any subset of the tasks. Use rms() for a collective norm of the field.
   double zmin = x_[0];
   double zmax = x_[0];
   double zavg = 0.0;
-  for (int jj = 0; jj < resol_; ++jj) {
+  for (int jj = 0; jj < nlocal_; ++jj) {
     if (x_[jj] < zmin) zmin = x_[jj];
     if (x_[jj] > zmax) zmax = x_[jj];
     zavg += x_[jj];
   }
-  zavg /= resol_;
+  zavg /= nlocal_;
+  if (comm_.size() > 1) os << " Points " << istart_ << " to " << istart_ + nlocal_ - 1 << ":";
   os << " Min=" << zmin << ", Max=" << zmax << ", Average=" << zavg;
 }
 // -----------------------------------------------------------------------------
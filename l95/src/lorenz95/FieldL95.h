@@ -15,12 +15,18 @@
 #include <string>
 #include <vector>
 
+#include "eckit/mpi/Comm.h"
+
 #include "oops/util/parameters/OptionalParameter.h"
 #include "oops/util/parameters/Parameters.h"
 #include "oops/util/parameters/RequiredParameter.h"
 #include "oops/util/Printable.h"
 #include "oops/util/Serializable.h"
 
+namespace util {
+  class DateTime;
+}
+
 namespace lorenz95 {
 // Forward declarations
   class LocsL95;
@@ -82,10 +88,28 @@ class FieldL95 : public util::Printable,
 /// Utilities
   void read(std::ifstream &);
   void write(std::ofstream &) const;
+  static bool isBinary(const std::string &);
+  void readBinary(const std::string &, util::DateTime &, const bool mmap = false);
+  void writeBinary(const std::string &, const util::DateTime &) const;
   double rms() const;
 
+/// Distributed memory
+  void extend(std::vector<double> &, const int, const int) const;
+  void extendAD(const std::vector<double> &, const int, const int);
+/// Halo exchange, in place, of a buffer distributed like this field but holding several
+/// interleaved values per gridpoint (e.g. ensemble members), with west and east halo points
+  void haloExchange(std::vector<double> &, const size_t, const int, const int) const;
+/// Gathers the whole field on every task. Memory and work are not distributed, so users
+/// (the spectral covariance and localization) are limited to maxGatherSize gridpoints.
+  void allGather(std::vector<double> &) const;
+  void setGlobal(const std::vector<double> &);
+  static const int maxGatherSize = 1000000;
+
 /// Set and get
   const int & resol() const {return resol_;}
+  const int & nlocal() const {return nlocal_;}
+  const int & istart() const {return istart_;}
+  const eckit::mpi::Comm & comm() const {return comm_;}
   double & operator[](const int ii) {return x_[ii];}
   const double & operator[](const int ii) const {return x_[ii];}
   std::vector<double> & asVector() {return x_;}
@@ -99,6 +123,9 @@ class FieldL95 : public util::Printable,
  private:
   void print(std::ostream &) const override;
   const int resol_;
+  const eckit::mpi::Comm & comm_;
+  const int istart_;
+  const int nlocal_;
   std::vector<double> x_;
 };
 // -----------------------------------------------------------------------------
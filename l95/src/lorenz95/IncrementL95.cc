@@ -144,6 +144,16 @@ void IncrementL95::read(const ReadParameters_ & params) {
   std::string filename(params.filename);
   sf::swapNameMember(params.member, filename);
   oops::Log::trace() << "IncrementL95::read opening " << filename << std::endl;
+  if (FieldL95::isBinary(filename)) {
+    util::DateTime tt;
+    fld_.readBinary(filename, tt, params.memoryMap);
+    const util::DateTime tc(params.date);
+    if (tc != tt) {
+      ABORT("IncrementL95::read: date and data file inconsistent.");
+    }
+    time_ = tt;
+    return;
+  }
   std::ifstream fin(filename.c_str());
   if (!fin.is_open()) ABORT("IncrementL95::read: Error opening file: " + filename);
 
@@ -189,17 +199,28 @@ void IncrementL95::write(const WriteParameters_ & params) const {
   sf::swapNameMember(params.member, filename);
   filename += ".l95";
 
-  oops::Log::trace() << "IncrementL95::write opening " << filename << std::endl;
-  std::ofstream fout(filename.c_str());
-  if (!fout.is_open()) ABORT("IncrementL95::write: Error opening file: " + filename);
+  if (params.binary) {
+    oops::Log::trace() << "IncrementL95::write binary file " << filename << std::endl;
+    fld_.writeBinary(filename, time_);
+    return;
+  }
 
-  fout << fld_.resol() << std::endl;
-  fout << time_ << std::endl;
+// Only task 0 opens the file, all tasks take part in gathering the field
+  const bool root = (fld_.comm().rank() == 0);
+  std::ofstream fout;
+  if (root) {
+    oops::Log::trace() << "IncrementL95::write opening " << filename << std::endl;
+    fout.open(filename.c_str());
+    if (!fout.is_open()) ABORT("IncrementL95::write: Error opening file: " + filename);
+    fout << fld_.resol() << std::endl;
+    fout << time_ << std::endl;
+  }
   fld_.write(fout);
-  fout << std::endl;
-
-  fout.close();
-  oops::Log::trace() << "IncrementL95::write file closed." << std::endl;
+  if (root) {
+    fout << std::endl;
+    fout.close();
+    oops::Log::trace() << "IncrementL95::write file closed." << std::endl;
+  }
 }
 // -----------------------------------------------------------------------------
 void IncrementL95::print(std::ostream & os) const {
@@ -60,6 +60,8 @@ class IncrementL95ReadParameters : public oops::Parameters {
   oops::RequiredParameter<util::DateTime> date{"date", this};
   /// \brief Ensemble member index.
   oops::OptionalParameter<int> member{"member", this};
+  /// \brief Memory-map binary files instead of reading them through a stream.
+  oops::Parameter<bool> memoryMap{"memory map", false, this};
 };
 
 // -----------------------------------------------------------------------------
@@ -72,6 +74,8 @@ class IncrementL95WriteParameters : public oops::WriteParametersBase {
   oops::Parameter<std::string> datadir{"datadir", ".", this};
   oops::RequiredParameter<std::string> exp{"exp", this};
   oops::RequiredParameter<std::string> type{"type", this};
+  /// \brief Write a binary file instead of text.
+  oops::Parameter<bool> binary{"binary", false, this};
 };
 
 // -----------------------------------------------------------------------------
@@ -142,7 +146,7 @@ class IncrementL95 : public util::Printable,
   const FieldL95 & getField() const {return fld_;}
   FieldL95 & getField() {return fld_;}
   std::shared_ptr<const Resolution> geometry() const {
-    std::shared_ptr<const Resolution> geom(new Resolution(fld_.resol()));
+    std::shared_ptr<const Resolution> geom(new Resolution(fld_.resol(), fld_.comm()));
     return geom;
   }
   std::vector<double> & asVector() {return fld_.asVector();}
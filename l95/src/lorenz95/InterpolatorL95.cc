@@ -25,11 +25,14 @@ InterpolatorL95::InterpolatorL95(const eckit::Configuration &, const Resolution
 {
   const size_t res = resol.npoints();
   const double dres = static_cast<double>(res);
+  const int istart = resol.istart();
   for (size_t jj = 0; jj < nout_; ++jj) {
     size_t ii = round(locs[jj] * dres);
     ASSERT(ii >= 0 && ii <= res);
     if (ii == res) ii = 0;
-    ilocs_[jj] = ii;
+// Locations have been distributed to the task owning the nearest gridpoint
+    ASSERT(resol.owner(ii) == static_cast<int>(resol.getComm().rank()));
+    ilocs_[jj] = ii - istart;
   }
 }
 
@@ -12,7 +12,8 @@
 namespace lorenz95 {
 
 // -----------------------------------------------------------------------------
-Iterator::Iterator(const Resolution & res, const int & index): res_(res.npoints()), index_(index) {
+Iterator::Iterator(const Resolution & res, const int & index)
+  : res_(res.npoints()), istart_(res.istart()), index_(index) {
 }
 
 // -----------------------------------------------------------------------------
@@ -27,7 +28,8 @@ bool Iterator::operator!=(const Iterator & other) const {
 
 // -----------------------------------------------------------------------------
 eckit::geometry::Point3 Iterator::operator*() const {
-  return eckit::geometry::Point3(index_/static_cast<double>(res_), 0.0, 0.0);
+  return eckit::geometry::Point3((istart_ + index_)/static_cast<double>(res_), 0.0,
+                                 0.0);
 }
 
 // -----------------------------------------------------------------------------
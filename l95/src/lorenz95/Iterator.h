@@ -43,6 +43,7 @@ class Iterator: public std::iterator<std::forward_iterator_tag,
  private:
   void print(std::ostream & os) const override {os << index_;}
   const int res_;
+  const int istart_;
   int index_;
 };
 
@@ -14,22 +14,34 @@
 #include <unsupported/Eigen/FFT>
 #include <algorithm>
 #include <cmath>
+#include <complex>
+#include <vector>
 
 #include "eckit/config/Configuration.h"
 #include "eckit/exception/Exceptions.h"
 
+#include "lorenz95/FieldL95.h"
 #include "lorenz95/IncrementL95.h"
 #include "lorenz95/Resolution.h"
 
 // -----------------------------------------------------------------------------
 namespace lorenz95 {
 // -----------------------------------------------------------------------------
+namespace {
+/// FFT plans are created on first use and reused by all transforms of the calling thread
+Eigen::FFT<double> & threadFFT() {
+  static thread_local Eigen::FFT<double> fft;
+  return fft;
+}
+}  // namespace
+// -----------------------------------------------------------------------------
 LocalizationMatrixL95::LocalizationMatrixL95(const Resolution & resol,
                                              const oops::Variables & vars,
                                              const eckit::Configuration & config)
   : resol_(resol.npoints()),
-    rscale_(1.0/config.getDouble("length_scale"))
+    rscale_(1.0/config.getDouble("length_scale")), coefs_()
 {
+  ASSERT(resol.npoints() <= FieldL95::maxGatherSize);
 // Gaussian structure function
   unsigned int size = resol_/2+1;
   std::vector<double> locfct(resol_);
@@ -38,9 +50,8 @@ LocalizationMatrixL95::LocalizationMatrixL95(const Resolution & resol,
     locfct[jj] = std::exp(-0.5*zz*zz);
   }
 // Go to Fourier space
-  Eigen::FFT<double> fft;
   std::vector<std::complex<double> > four(size);
-  fft.fwd(four, locfct);
+  threadFFT().fwd(four, locfct);
 // Save Fourier coefficients
   coefs_.resize(size);
   for (unsigned int jj = 0; jj < size; ++jj) {
@@ -51,24 +62,45 @@ LocalizationMatrixL95::LocalizationMatrixL95(const Resolution & resol,
 void LocalizationMatrixL95::randomize(IncrementL95 & dx) const {
   dx.random();
   unsigned int size = resol_/2+1;
-  Eigen::FFT<double> fft;
+  std::vector<double> xglb;
+  dx.getField().allGather(xglb);
   std::vector<std::complex<double> > four(size);
-  fft.fwd(four, dx.asVector());
+  threadFFT().fwd(four, xglb);
   for (unsigned int jj = 0; jj < size; ++jj) {
     four[jj] *= std::sqrt(coefs_[jj]);
   }
-  fft.inv(dx.asVector(), four);
+  threadFFT().inv(xglb, four);
+  dx.getField().setGlobal(xglb);
 }
 // -----------------------------------------------------------------------------
 void LocalizationMatrixL95::multiply(IncrementL95 & dx) const {
+  std::vector<double> xglb;
+  dx.getField().allGather(xglb);
+  this->spectralMultiply(xglb);
+  dx.getField().setGlobal(xglb);
+}
+// -----------------------------------------------------------------------------
+void LocalizationMatrixL95::multiplyEnsemble(const std::vector<IncrementL95 *> & dxs) const {
+// Communications are done for all members first, the transforms of the members are then
+// independent and share the FFT plan of each thread
+  const int nm = dxs.size();
+  std::vector<std::vector<double>> xglb(nm);
+  for (int jm = 0; jm < nm; ++jm) dxs[jm]->getField().allGather(xglb[jm]);
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int jm = 0; jm < nm; ++jm) this->spectralMultiply(xglb[jm]);
+  for (int jm = 0; jm < nm; ++jm) dxs[jm]->getField().setGlobal(xglb[jm]);
+}
+// -----------------------------------------------------------------------------
+void LocalizationMatrixL95::spectralMultiply(std::vector<double> & xglb) const {
   unsigned int size = resol_/2+1;
-  Eigen::FFT<double> fft;
   std::vector<std::complex<double> > four(size);
-  fft.fwd(four, dx.asVector());
+  threadFFT().fwd(four, xglb);
   for (unsigned int jj = 0; jj < size; ++jj) {
     four[jj] *= coefs_[jj];
   }
-  fft.inv(dx.asVector(), four);
+  threadFFT().inv(xglb, four);
 }
 // -----------------------------------------------------------------------------
 void LocalizationMatrixL95::print(std::ostream & os) const {
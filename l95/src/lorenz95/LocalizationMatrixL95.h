@@ -28,6 +28,8 @@ namespace lorenz95 {
   class IncrementL95;
 
 /// Localization matrix for Lorenz 95 model.
+/// Like ErrorCovarianceL95, it is applied in spectral space on the whole field gathered on
+/// every task, so the resolution is limited to FieldL95::maxGatherSize gridpoints.
 
 // -----------------------------------------------------------------------------
 class LocalizationMatrixL95: public oops::interface::LocalizationBase<lorenz95::L95Traits> {
@@ -37,9 +39,13 @@ class LocalizationMatrixL95: public oops::interface::LocalizationBase<lorenz95::
   LocalizationMatrixL95(const Resolution &, const oops::Variables &, const eckit::Configuration &);
   void randomize(IncrementL95 &) const override;
   void multiply(IncrementL95 &) const override;
+  void multiplyEnsemble(const std::vector<IncrementL95 *> &) const override;
+  bool hasBatchedMultiply() const override {return true;}
 
  private:
   void print(std::ostream &) const override;
+/// Multiplies a global field by the localization in spectral space
+  void spectralMultiply(std::vector<double> &) const;
   const unsigned int resol_;
   const double rscale_;
   std::vector<double> coefs_;
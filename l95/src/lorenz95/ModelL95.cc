@@ -9,6 +9,8 @@
  */
 
 
+#include <vector>
+
 #include "eckit/config/Configuration.h"
 
 #include "lorenz95/FieldL95.h"
@@ -17,6 +19,7 @@
 #include "lorenz95/ModelTrajectory.h"
 #include "lorenz95/Resolution.h"
 #include "lorenz95/StateL95.h"
+#include "lorenz95/WorkSpaceGuard.h"
 
 #include "oops/util/Duration.h"
 #include "oops/util/Logger.h"
@@ -31,7 +34,9 @@ static oops::interface::ModelMaker<L95Traits, ModelL95> makermodel_("L95");
 ModelL95::ModelL95(const Resolution & resol, const ModelL95Parameters & params)
   : resol_(resol), f_(params.f),
     tstep_(params.tstep),
-    dt_(tstep_.toSeconds()/432000.0), vars_({"x"})
+    dt_(tstep_.toSeconds()/432000.0), vars_({"x"}), batchedStep_(params.batchedStep),
+    inUse_(false), dx_(resol_), zz_(resol_), dz_(resol_), ext_(),
+    ensx_(), ensdx_(), ensdz_(), ensext_()
 {
   oops::Log::info() << *this << std::endl;
   oops::Log::trace() << "ModelL95::ModelL95 created" << std::endl;
@@ -55,35 +60,110 @@ void ModelL95::step(StateL95 & xx, const ModelBias & bias) const {
 
 void ModelL95::stepRK(FieldL95 & xx, const ModelBias & bias,
                       ModelTrajectory & traj) const {
-  FieldL95 dx(xx, false);
-  FieldL95 zz(xx, false);
-  FieldL95 dz(xx, false);
-
-  zz = xx;
-  traj.set(zz);
-  this->tendencies(zz, bias.bias(), dz);
-  dx = dz;
-
-  zz = xx;
-  zz.axpy(0.5, dz);
-  traj.set(zz);
-  this->tendencies(zz, bias.bias(), dz);
-  dx.axpy(2.0, dz);
-
-  zz = xx;
-  zz.axpy(0.5, dz);
-  traj.set(zz);
-  this->tendencies(zz, bias.bias(), dz);
-  dx.axpy(2.0, dz);
-
-  zz = xx;
-  zz += dz;
-  traj.set(zz);
-  this->tendencies(zz, bias.bias(), dz);
-  dx += dz;
+  const WorkSpaceGuard guard(inUse_, classname());
+  const int nn = xx.nlocal();
+  std::vector<double> & xv = xx.asVector();
+  std::vector<double> & dx = dx_.asVector();
+  std::vector<double> & zz = zz_.asVector();
+  const std::vector<double> & dz = dz_.asVector();
+
+  zz_ = xx;
+  traj.set(zz_);
+  this->tendencies(zz_, bias.bias(), dz_);
+  for (int jj = 0; jj < nn; ++jj) {
+    dx[jj] = dz[jj];
+    zz[jj] = xv[jj] + 0.5 * dz[jj];
+  }
+
+  traj.set(zz_);
+  this->tendencies(zz_, bias.bias(), dz_);
+  for (int jj = 0; jj < nn; ++jj) {
+    dx[jj] += 2.0 * dz[jj];
+    zz[jj] = xv[jj] + 0.5 * dz[jj];
+  }
 
+  traj.set(zz_);
+  this->tendencies(zz_, bias.bias(), dz_);
+  for (int jj = 0; jj < nn; ++jj) {
+    dx[jj] += 2.0 * dz[jj];
+    zz[jj] = xv[jj] + dz[jj];
+  }
+
+  traj.set(zz_);
+  this->tendencies(zz_, bias.bias(), dz_);
   const double zt = 1.0/6.0;
-  xx.axpy(zt, dx);
+  for (int jj = 0; jj < nn; ++jj) xv[jj] += zt * (dx[jj] + dz[jj]);
+}
+
+// -----------------------------------------------------------------------------
+
+void ModelL95::stepEnsemble(std::vector<StateL95 *> & xx, const ModelBias & bias) const {
+  const WorkSpaceGuard guard(inUse_, classname());
+  const size_t nm = xx.size();
+  const size_t nn = resol_.nlocal();
+  const size_t nx = nn * nm;
+
+// Values are stored member first: member jm at gridpoint jj is at index jj*nm+jm.
+// Stage values are written directly between the halo points of ensext_ (two gridpoints
+// to the west and one to the east), so members stay interleaved through all stages.
+  ensx_.resize(nx);
+  ensdx_.resize(nx);
+  ensdz_.resize(nx);
+  ensext_.resize((nn + 3) * nm);
+  double * zz = ensext_.data() + 2 * nm;
+  for (size_t jm = 0; jm < nm; ++jm) {
+    const std::vector<double> & xm = xx[jm]->getField().asVector();
+    for (size_t jj = 0; jj < nn; ++jj) ensx_[jj * nm + jm] = xm[jj];
+  }
+
+  for (size_t jj = 0; jj < nx; ++jj) zz[jj] = ensx_[jj];
+  this->tendenciesEnsemble(nm, bias.bias());
+  for (size_t jj = 0; jj < nx; ++jj) {
+    ensdx_[jj] = ensdz_[jj];
+    zz[jj] = ensx_[jj] + 0.5 * ensdz_[jj];
+  }
+
+  this->tendenciesEnsemble(nm, bias.bias());
+  for (size_t jj = 0; jj < nx; ++jj) {
+    ensdx_[jj] += 2.0 * ensdz_[jj];
+    zz[jj] = ensx_[jj] + 0.5 * ensdz_[jj];
+  }
+
+  this->tendenciesEnsemble(nm, bias.bias());
+  for (size_t jj = 0; jj < nx; ++jj) {
+    ensdx_[jj] += 2.0 * ensdz_[jj];
+    zz[jj] = ensx_[jj] + ensdz_[jj];
+  }
+
+  this->tendenciesEnsemble(nm, bias.bias());
+  const double zt = 1.0/6.0;
+  for (size_t jj = 0; jj < nx; ++jj) ensx_[jj] += zt * (ensdx_[jj] + ensdz_[jj]);
+
+  for (size_t jm = 0; jm < nm; ++jm) {
+    std::vector<double> & xm = xx[jm]->getField().asVector();
+    for (size_t jj = 0; jj < nn; ++jj) xm[jj] = ensx_[jj * nm + jm];
+    xx[jm]->validTime() += tstep_;
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void ModelL95::tendenciesEnsemble(const size_t nm, const double & bias) const {
+  const size_t nn = resol_.nlocal();
+// One halo exchange for all members (zz_ only provides the distribution of the field)
+  zz_.haloExchange(ensext_, nm, 2, 1);
+// Neighbouring gridpoints of the same member are nm values apart, so the loop
+// runs contiguously over all members
+  const size_t nx = nn * nm;
+  const double * ext = ensext_.data();
+  double * tend = ensdz_.data();
+  const size_t i1 = nm;
+  const size_t i2 = 2 * nm;
+  const size_t i3 = 3 * nm;
+  for (size_t jj = 0; jj < nx; ++jj) {
+    const double dxdt = -ext[jj] * ext[jj+i1] + ext[jj+i1] * ext[jj+i3] - ext[jj+i2] + f_ - bias;
+    tend[jj] = dt_ * dxdt;
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -93,18 +173,17 @@ void ModelL95::stepRK(FieldL95 & xx, const ModelBias & bias,
 #endif
 void ModelL95::tendencies(const FieldL95 & xx, const double & bias,
                           FieldL95 & dx) const {
-  const int nn = resol_.npoints();
+  const int nn = xx.nlocal();
+  // local values with two halo points to the west and one to the east, so that
+  // the loop below has no periodic index arithmetic
+  xx.extend(ext_, 2, 1);
+  const double * ext = ext_.data();
+  double * tend = dx.asVector().data();
   // intel 19 is doing some agressive optimization of this loop that
   // is modifying the solution.
   for (int jj = 0; jj < nn; ++jj) {
-    int jm2 = jj - 2;
-    int jm1 = jj - 1;
-    int jp1 = jj + 1;
-    if (jm2 < 0) jm2 += nn;
-    if (jm1 < 0) jm1 += nn;
-    if (jp1 >= nn) jp1 -= nn;
-    const double dxdt = -xx[jm2] * xx[jm1] + xx[jm1] * xx[jp1] - xx[jj] + f_ - bias;
-    dx[jj] = dt_ * dxdt;
+    const double dxdt = -ext[jj] * ext[jj+1] + ext[jj+1] * ext[jj+3] - ext[jj+2] + f_ - bias;
+    tend[jj] = dt_ * dxdt;
   }
 }
 #ifdef __INTEL_COMPILER
@@ -11,8 +11,10 @@
 #ifndef LORENZ95_MODELL95_H_
 #define LORENZ95_MODELL95_H_
 
+#include <atomic>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "eckit/config/Configuration.h"
 #include "oops/base/Variables.h"
@@ -20,15 +22,16 @@
 #include "oops/util/DateTime.h"
 #include "oops/util/Duration.h"
 #include "oops/util/ObjectCounter.h"
+#include "oops/util/parameters/Parameter.h"
 #include "oops/util/parameters/Parameters.h"
 #include "oops/util/parameters/RequiredParameter.h"
 #include "oops/util/Printable.h"
 
+#include "lorenz95/FieldL95.h"
 #include "lorenz95/L95Traits.h"
 #include "lorenz95/Resolution.h"
 
 namespace lorenz95 {
-  class FieldL95;
   class ModelBias;
   class ModelTrajectory;
   class StateL95;
@@ -41,6 +44,11 @@ class ModelL95Parameters : public oops::ModelParametersBase {
  public:
   oops::RequiredParameter<util::Duration> tstep{"tstep", this};
   oops::RequiredParameter<double> f{"f", this};
+  /// Step ensemble members together (see ModelL95::stepEnsemble). This is faster for small
+  /// ensembles of small fields only: above about 4e4 values per task (gridpoints times
+  /// members), the interleaved work space no longer fits in cache and stepping the members
+  /// one at a time is faster.
+  oops::Parameter<bool> batchedStep{"batched step", false, this};
 };
 
 /// Lorenz 95 model configuration and computations.
@@ -63,6 +71,11 @@ class ModelL95 : public oops::interface::ModelBase<L95Traits>,
   void finalize(StateL95 &) const;
   void stepRK(FieldL95 &, const ModelBias &, ModelTrajectory &) const;
 
+// Run the forecasts of several members together, with one halo exchange per stage for
+// all members (instead of one per member)
+  void stepEnsemble(std::vector<StateL95 *> &, const ModelBias &) const override;
+  bool hasBatchedStep() const override {return batchedStep_;}
+
 // Information and diagnostics
   const util::Duration & timeResolution() const {return tstep_;}
   const oops::Variables & variables() const {return vars_;}
@@ -70,6 +83,7 @@ class ModelL95 : public oops::interface::ModelBase<L95Traits>,
  private:
   void print(std::ostream &) const;
   void tendencies(const FieldL95 &, const double &, FieldL95 &) const;
+  void tendenciesEnsemble(const size_t, const double &) const;
 
 // Data
   const Resolution resol_;
@@ -77,6 +91,20 @@ class ModelL95 : public oops::interface::ModelBase<L95Traits>,
   const util::Duration tstep_;
   const double dt_;
   const oops::Variables vars_;
+  const bool batchedStep_;
+// Work space reused by every time step: steps of one model must not run concurrently
+// (checked with inUse_, see WorkSpaceGuard)
+  mutable std::atomic<bool> inUse_;
+  mutable FieldL95 dx_;
+  mutable FieldL95 zz_;
+  mutable FieldL95 dz_;
+  mutable std::vector<double> ext_;
+// Member-interleaved work space for ensemble stepping (ensext_ holds the stage values
+// with their halo points)
+  mutable std::vector<double> ensx_;
+  mutable std::vector<double> ensdx_;
+  mutable std::vector<double> ensdz_;
+  mutable std::vector<double> ensext_;
 };
 
 // -----------------------------------------------------------------------------
@@ -8,6 +8,7 @@
 #ifndef LORENZ95_OBSDATA1D_H_
 #define LORENZ95_OBSDATA1D_H_
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <ostream>
@@ -47,9 +48,16 @@ class ObsData1D : public util::Printable,
   void mask(const ObsData1D<int> &);
 
   size_t nobs() const {return data_.size();}
-  DATATYPE & operator[] (const size_t ii) {return data_.at(ii);}
+  DATATYPE & operator[] (const size_t ii) {activeValid_ = false; return data_.at(ii);}
   const DATATYPE & operator[] (const size_t ii) const {return data_.at(ii);}
 
+/// Active set: increasing indices of the zero entries, i.e. of the observations currently
+/// passing QC when this holds QC flags. Built on first use, then maintained by reject() so
+/// that a chain of filters only visits the surviving observations.
+  const std::vector<size_t> & active() const;
+/// Set entries at the increasing indices \p indices to \p flag and drop them from the active set
+  void reject(const std::vector<size_t> & indices, const DATATYPE flag);
+
 // I/O
   void read(const std::string &);
   void save(const std::string &) const;
@@ -59,6 +67,8 @@ class ObsData1D : public util::Printable,
 
   const ObsTable & obsdb_;
   std::vector<DATATYPE> data_;
+  mutable std::vector<size_t> active_;
+  mutable bool activeValid_ = false;
 };
 
 //-----------------------------------------------------------------------------
@@ -74,7 +84,8 @@ ObsData1D<DATATYPE>::ObsData1D(const ObsTable & ot, const oops::Variables &,
 // -----------------------------------------------------------------------------
 template<typename DATATYPE>
 ObsData1D<DATATYPE>::ObsData1D(const ObsData1D & other)
-  : obsdb_(other.obsdb_), data_(other.data_)
+  : obsdb_(other.obsdb_), data_(other.data_), active_(other.active_),
+    activeValid_(other.activeValid_)
 {}
 // -----------------------------------------------------------------------------
 template<typename DATATYPE>
@@ -95,6 +106,8 @@ template<typename DATATYPE>
 ObsData1D<DATATYPE> & ObsData1D<DATATYPE>::operator= (const ObsData1D & rhs) {
   ASSERT(data_.size() == rhs.data_.size());
   data_ = rhs.data_;
+  active_ = rhs.active_;
+  activeValid_ = rhs.activeValid_;
   return *this;
 }
 // -----------------------------------------------------------------------------
@@ -103,6 +116,7 @@ void ObsData1D<DATATYPE>::zero() {
   for (size_t jj = 0; jj < data_.size(); ++jj) {
     data_.at(jj) = static_cast<DATATYPE>(0);
   }
+  activeValid_ = false;
 }
 // -----------------------------------------------------------------------------
 template<typename DATATYPE>
@@ -111,11 +125,43 @@ void ObsData1D<DATATYPE>::mask(const ObsData1D<int> & mask) {
   for (size_t jj = 0; jj < data_.size(); ++jj) {
     if (mask[jj]) data_.at(jj) = missing;
   }
+  activeValid_ = false;
+}
+// -----------------------------------------------------------------------------
+template<typename DATATYPE>
+const std::vector<size_t> & ObsData1D<DATATYPE>::active() const {
+  if (!activeValid_) {
+    active_.clear();
+    for (size_t jj = 0; jj < data_.size(); ++jj) {
+      if (data_[jj] == static_cast<DATATYPE>(0)) active_.push_back(jj);
+    }
+    activeValid_ = true;
+  }
+  return active_;
+}
+// -----------------------------------------------------------------------------
+template<typename DATATYPE>
+void ObsData1D<DATATYPE>::reject(const std::vector<size_t> & indices, const DATATYPE flag) {
+  ASSERT(std::is_sorted(indices.begin(), indices.end()));
+  for (const size_t jj : indices) data_.at(jj) = flag;
+  if (flag == static_cast<DATATYPE>(0)) {
+    activeValid_ = false;
+  } else if (activeValid_ && !indices.empty()) {
+    // Both lists are increasing: drop the rejected indices in a single merge pass
+    std::vector<size_t>::const_iterator irej = indices.begin();
+    size_t nkeep = 0;
+    for (size_t jj = 0; jj < active_.size(); ++jj) {
+      while (irej != indices.end() && *irej < active_[jj]) ++irej;
+      if (irej == indices.end() || *irej != active_[jj]) active_[nkeep++] = active_[jj];
+    }
+    active_.resize(nkeep);
+  }
 }
 // -----------------------------------------------------------------------------
 template<typename DATATYPE>
 void ObsData1D<DATATYPE>::read(const std::string & name) {
   obsdb_.getdb(name, data_);
+  activeValid_ = false;
 }
 // -----------------------------------------------------------------------------
 template<typename DATATYPE>
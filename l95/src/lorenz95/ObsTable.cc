@@ -12,9 +12,10 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iostream>
-#include <map>
 #include <memory>
 #include <string>
 #include <utility>
@@ -38,6 +39,28 @@ namespace sf = util::stringfunctions;
 // -----------------------------------------------------------------------------
 namespace lorenz95 {
 // -----------------------------------------------------------------------------
+// Binary obs tables start with a magic string, the number of columns, of observations
+// and of slices (the blocks written by each task). Then come the offset and size of
+// each slice, and a directory giving the name, type and byte offset of each column.
+// Times are stored as seconds since binaryEpoch, other columns as doubles, all in
+// native byte order.
+static const char binaryMagic[8] = {'L', '9', '5', 'O', 'B', 'S', '1', '\0'};
+static const char * binaryEpoch = "1970-01-01T00:00:00Z";
+enum BinaryColumnType : std::int64_t {timeSeconds = 0, realDouble = 1};
+// -----------------------------------------------------------------------------
+template <typename T>
+static void writeBinary(std::ostream & out, const T & val) {
+  out.write(reinterpret_cast<const char *>(&val), sizeof(T));
+}
+// -----------------------------------------------------------------------------
+template <typename T>
+static T readBinary(std::istream & in) {
+  T val;
+  in.read(reinterpret_cast<char *>(&val), sizeof(T));
+  if (!in) ABORT("ObsTable: error reading binary obs table header");
+  return val;
+}
+// -----------------------------------------------------------------------------
 
 ObsTable::ObsTable(const Parameters_ & params, const eckit::mpi::Comm & comm,
                    const util::DateTime & bgn, const util::DateTime & end,
@@ -48,7 +71,16 @@ ObsTable::ObsTable(const Parameters_ & params, const eckit::mpi::Comm & comm,
   oops::Log::trace() << "ObsTable::ObsTable starting" << std::endl;
   if (params.obsdatain.value() != boost::none) {
     nameIn_ = params.obsdatain.value()->engine.value().obsfile;
-    otOpen(nameIn_);
+    std::ifstream fin(nameIn_.c_str(), std::ios::binary);
+    char magic[sizeof(binaryMagic)];
+    fin.read(magic, sizeof(magic));
+    const bool binary = fin && std::memcmp(magic, binaryMagic, sizeof(magic)) == 0;
+    fin.close();
+    if (binary) {
+      otOpenBinary(nameIn_);
+    } else {
+      otOpen(nameIn_);
+    }
   }
   //  Generate locations etc... if required
   if (params.generate.value() != boost::none) {
@@ -56,6 +88,7 @@ ObsTable::ObsTable(const Parameters_ & params, const eckit::mpi::Comm & comm,
   }
   if (params.obsdataout.value() != boost::none) {
     nameOut_ = params.obsdataout.value()->engine.value().obsfile;
+    binaryOut_ = params.obsdataout.value()->engine.value().binary;
     sf::swapNameMember(params.toConfiguration(), nameOut_);
   }
   oops::Log::trace() << "ObsTable::ObsTable created nobs = " << nobs() << std::endl;
@@ -70,13 +103,19 @@ ObsTable::~ObsTable() {
 // -----------------------------------------------------------------------------
 
 void ObsTable::save() const {
-  if (!nameOut_.empty()) otWrite(nameOut_);
+  if (!nameOut_.empty()) {
+    if (binaryOut_) {
+      otWriteBinary(nameOut_);
+    } else {
+      otWrite(nameOut_);
+    }
+  }
 }
 
 // -----------------------------------------------------------------------------
 
 bool ObsTable::has(const std::string & col) const {
-  return (data_.find(col) != data_.end());
+  return (colindex_.find(col) != colindex_.end());
 }
 
 // -----------------------------------------------------------------------------
@@ -115,11 +154,14 @@ void ObsTable::putdb(const std::string & col, const std::vector<float> & vec) co
 
 void ObsTable::putdb(const std::string & col, const std::vector<double> & vec) const {
   ASSERT(vec.size() == nobs());
-  if (data_.find(col) != data_.end()) {
+  auto ic = colindex_.find(col);
+  if (ic != colindex_.end()) {
     oops::Log::info() << "ObsTable::putdb over-writing " << col << std::endl;
-    data_[col] = vec;
+    columns_[ic->second] = vec;
   } else {
-    data_.insert(std::pair<std::string, std::vector<double> >(col, vec));
+    colindex_[col] = columns_.size();
+    colnames_.push_back(col);
+    columns_.push_back(vec);
   }
 }
 
@@ -160,19 +202,43 @@ void ObsTable::getdb(const std::string & col, std::vector<float> & vec) const {
 // -----------------------------------------------------------------------------
 
 void ObsTable::getdb(const std::string & col, std::vector<double> & vec) const {
-  std::map<std::string, std::vector<double> >::const_iterator ic = data_.find(col);
-  if (ic == data_.end()) {
-    oops::Log::error() << "ObsTable::getdb " << col << " not found." << std::endl;
-    ABORT("ObsTable::getdb column not found");
-  }
+  const std::vector<double> & column = this->column(col);
   vec.resize(nobs());
   for (unsigned int jobs = 0; jobs < nobs(); ++jobs) {
-    vec[jobs] = ic->second[jobs];
+    vec[jobs] = column[jobs];
   }
 }
 
 // -----------------------------------------------------------------------------
 
+const std::vector<double> & ObsTable::column(const std::string & col) const {
+  return columns_[this->columnIndex(col)];
+}
+
+// -----------------------------------------------------------------------------
+
+size_t ObsTable::columnIndex(const std::string & col) const {
+  auto ic = colindex_.find(col);
+  if (ic == colindex_.end()) {
+    oops::Log::error() << "ObsTable::getdb " << col << " not found." << std::endl;
+    ABORT("ObsTable::getdb column not found");
+  }
+  return ic->second;
+}
+
+// -----------------------------------------------------------------------------
+
+std::vector<size_t> ObsTable::sortedColumns() const {
+// Columns in alphabetical order, as they appear in files
+  std::vector<size_t> order(colnames_.size());
+  for (size_t jc = 0; jc < order.size(); ++jc) order[jc] = jc;
+  std::sort(order.begin(), order.end(),
+            [this](size_t ia, size_t ib) {return colnames_[ia] < colnames_[ib];});
+  return order;
+}
+
+// -----------------------------------------------------------------------------
+
 void ObsTable::generateDistribution(const ObsGenerateParameters & params) {
   oops::Log::trace() << "ObsTable::generateDistribution starting" << std::endl;
 
@@ -249,11 +315,13 @@ void ObsTable::otOpen(const std::string & filename) {
 
   fin >> nobs;
   locations_.clear();
-  std::vector<double> newcol;
   for (int jc = 0; jc < ncol; ++jc) {
-    ASSERT(data_.find(colnames[jc]) == data_.end());
-    data_.insert(std::pair<std::string, std::vector<double> >(colnames[jc], newcol));
+    ASSERT(colindex_.find(colnames[jc]) == colindex_.end());
+    colindex_[colnames[jc]] = columns_.size();
+    colnames_.push_back(colnames[jc]);
+    columns_.emplace_back();
   }
+  const std::vector<size_t> order = this->sortedColumns();
 
   times_.clear();
   for (int jobs = 0; jobs < nobs; ++jobs) {
@@ -269,11 +337,10 @@ void ObsTable::otOpen(const std::string & filename) {
     double loc;
     fin >> loc;
     if (inside) locations_.push_back(loc);
-    for (std::map<std::string, std::vector<double> >::iterator jo = data_.begin();
-         jo != data_.end(); ++jo) {
+    for (const size_t jc : order) {
       double val;
       fin >> val;
-      if (inside) jo->second.push_back(val);
+      if (inside) columns_[jc].push_back(val);
     }
   }
 
@@ -297,26 +364,27 @@ void ObsTable::otWrite(const std::string & filename) const {
   std::vector<double> locbuff(nobs);
   oops::mpi::gather(comm_, locations_, locbuff, ioproc);
 
-  std::vector<double> datasend(times_.size() * data_.size());
+  const std::vector<size_t> order = this->sortedColumns();
+  std::vector<double> datasend(times_.size() * columns_.size());
   size_t iobs = 0;
   for (size_t jobs = 0; jobs < times_.size(); ++jobs) {
-    for (auto jo = data_.begin(); jo != data_.end(); ++jo) {
-      datasend[iobs] = jo->second[jobs];
+    for (const size_t jc : order) {
+      datasend[iobs] = columns_[jc][jobs];
       ++iobs;
     }
   }
-  std::vector<double> databuff(data_.size() * nobs);
+  std::vector<double> databuff(columns_.size() * nobs);
   oops::mpi::gather(comm_, datasend, databuff, ioproc);
 
   if (comm_.rank() == ioproc) {
     std::ofstream fout(filename.c_str());
     if (!fout.is_open()) ABORT("ObsTable::otWrite: Error opening file: " + filename);
 
-    int ncol = data_.size();
+    int ncol = columns_.size();
     fout << ncol << std::endl;
 
-    for (auto jo = data_.begin(); jo != data_.end(); ++jo)
-      fout << jo->first << std::endl;
+    for (const size_t jc : order)
+      fout << colnames_[jc] << std::endl;
 
     fout << nobs << std::endl;
 
@@ -338,6 +406,169 @@ void ObsTable::otWrite(const std::string & filename) const {
   oops::Log::trace() << "ObsTable::otWrite done" << std::endl;
 }
 
+// -----------------------------------------------------------------------------
+
+void ObsTable::otOpenBinary(const std::string & filename) {
+  oops::Log::trace() << "ObsTable::otOpenBinary reading " << filename << std::endl;
+  std::ifstream fin(filename.c_str(), std::ios::binary);
+  if (!fin.is_open()) ABORT("ObsTable::otOpenBinary: Error opening file: " + filename);
+  char magic[sizeof(binaryMagic)];
+  fin.read(magic, sizeof(magic));
+
+  const std::int64_t ncol = readBinary<std::int64_t>(fin);
+  const std::int64_t nobs = readBinary<std::int64_t>(fin);
+  const std::int64_t nslices = readBinary<std::int64_t>(fin);
+  std::vector<std::int64_t> slicestart(nslices), slicesize(nslices);
+  for (std::int64_t js = 0; js < nslices; ++js) {
+    slicestart[js] = readBinary<std::int64_t>(fin);
+    slicesize[js] = readBinary<std::int64_t>(fin);
+  }
+  std::vector<std::string> names(ncol);
+  std::vector<std::int64_t> types(ncol), offsets(ncol);
+  for (std::int64_t jc = 0; jc < ncol; ++jc) {
+    const std::int64_t len = readBinary<std::int64_t>(fin);
+    names[jc].resize(len);
+    fin.read(&names[jc][0], len);
+    types[jc] = readBinary<std::int64_t>(fin);
+    offsets[jc] = readBinary<std::int64_t>(fin);
+  }
+
+// A file written by as many tasks holds the observations of this task in its own slice
+  std::int64_t first = 0;
+  std::int64_t count = nobs;
+  if (nslices == static_cast<std::int64_t>(comm_.size())) {
+    first = slicestart[comm_.rank()];
+    count = slicesize[comm_.rank()];
+  }
+
+// Read the time column first to select observations inside the window
+  const util::DateTime epoch(binaryEpoch);
+  std::vector<bool> inside(count, false);
+  times_.clear();
+  locations_.clear();
+  for (std::int64_t jc = 0; jc < ncol; ++jc) {
+    if (types[jc] != timeSeconds) continue;
+    ASSERT(names[jc] == "time");
+    std::vector<std::int64_t> secs(count);
+    fin.seekg(offsets[jc] + first * static_cast<std::int64_t>(sizeof(std::int64_t)));
+    fin.read(reinterpret_cast<char *>(secs.data()), count * sizeof(std::int64_t));
+    for (std::int64_t jobs = 0; jobs < count; ++jobs) {
+      const util::DateTime ttt = epoch + util::Duration(secs[jobs]);
+      inside[jobs] = ttt > winbgn_ && ttt <= winend_;
+      if (inside[jobs]) times_.push_back(ttt);
+    }
+  }
+
+  std::vector<double> vals(count);
+  for (std::int64_t jc = 0; jc < ncol; ++jc) {
+    if (types[jc] != realDouble) continue;
+    fin.seekg(offsets[jc] + first * static_cast<std::int64_t>(sizeof(double)));
+    fin.read(reinterpret_cast<char *>(vals.data()), count * sizeof(double));
+    std::vector<double> * col = &locations_;
+    if (names[jc] != "location") {
+      ASSERT(colindex_.find(names[jc]) == colindex_.end());
+      colindex_[names[jc]] = columns_.size();
+      colnames_.push_back(names[jc]);
+      columns_.emplace_back();
+      col = &columns_.back();
+    }
+    col->reserve(times_.size());
+    for (std::int64_t jobs = 0; jobs < count; ++jobs) {
+      if (inside[jobs]) col->push_back(vals[jobs]);
+    }
+  }
+  if (!fin) ABORT("ObsTable::otOpenBinary: Error reading file: " + filename);
+  ASSERT(locations_.size() == times_.size());
+
+  oops::Log::trace() << "ObsTable::otOpenBinary done" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+void ObsTable::otWriteBinary(const std::string & filename) const {
+  oops::Log::trace() << "ObsTable::otWriteBinary writing " << filename << std::endl;
+
+// Each task writes its own observations as one slice of every column
+  const size_t ntasks = comm_.size();
+  const std::int64_t mynobs = times_.size();
+  std::vector<std::int64_t> slicesize(ntasks);
+  comm_.allGather(mynobs, slicesize.begin(), slicesize.end());
+  std::vector<std::int64_t> slicestart(ntasks, 0);
+  for (size_t jt = 1; jt < ntasks; ++jt) {
+    slicestart[jt] = slicestart[jt - 1] + slicesize[jt - 1];
+  }
+  const std::int64_t nobs = slicestart[ntasks - 1] + slicesize[ntasks - 1];
+
+// Directory: time and location columns, then data columns in alphabetical order
+  std::vector<std::string> names = {"time", "location"};
+  std::vector<std::int64_t> types = {timeSeconds, realDouble};
+  const std::vector<size_t> order = this->sortedColumns();
+  for (const size_t jc : order) {
+    names.push_back(colnames_[jc]);
+    types.push_back(realDouble);
+  }
+  const std::int64_t ncol = names.size();
+  std::int64_t header = sizeof(binaryMagic) + (3 + 2 * ntasks) * sizeof(std::int64_t);
+  for (const std::string & name : names) header += 3 * sizeof(std::int64_t) + name.size();
+  std::vector<std::int64_t> offsets(ncol);
+  offsets[0] = header;
+  offsets[1] = offsets[0] + nobs * static_cast<std::int64_t>(sizeof(std::int64_t));
+  for (std::int64_t jc = 2; jc < ncol; ++jc) {
+    offsets[jc] = offsets[jc - 1] + nobs * static_cast<std::int64_t>(sizeof(double));
+  }
+  const std::int64_t filesize = offsets[ncol - 1] + nobs * sizeof(double);
+
+  if (comm_.rank() == 0) {
+    std::ofstream fout(filename.c_str(), std::ios::binary | std::ios::trunc);
+    if (!fout.is_open()) ABORT("ObsTable::otWriteBinary: Error opening file: " + filename);
+    fout.write(binaryMagic, sizeof(binaryMagic));
+    writeBinary(fout, ncol);
+    writeBinary(fout, nobs);
+    writeBinary(fout, static_cast<std::int64_t>(ntasks));
+    for (size_t jt = 0; jt < ntasks; ++jt) {
+      writeBinary(fout, slicestart[jt]);
+      writeBinary(fout, slicesize[jt]);
+    }
+    for (std::int64_t jc = 0; jc < ncol; ++jc) {
+      writeBinary(fout, static_cast<std::int64_t>(names[jc].size()));
+      fout.write(names[jc].data(), names[jc].size());
+      writeBinary(fout, types[jc]);
+      writeBinary(fout, offsets[jc]);
+    }
+    ASSERT(fout.tellp() == header);
+    if (filesize > header) {
+      fout.seekp(filesize - 1);
+      fout.put('\0');
+    }
+    if (!fout) ABORT("ObsTable::otWriteBinary: Error writing file: " + filename);
+  }
+  comm_.barrier();
+
+  if (mynobs > 0) {
+    std::fstream fout(filename.c_str(), std::ios::binary | std::ios::in | std::ios::out);
+    if (!fout.is_open()) ABORT("ObsTable::otWriteBinary: Error opening file: " + filename);
+    const util::DateTime epoch(binaryEpoch);
+    const std::int64_t first = slicestart[comm_.rank()];
+    std::vector<std::int64_t> secs(mynobs);
+    for (std::int64_t jobs = 0; jobs < mynobs; ++jobs) {
+      secs[jobs] = (times_[jobs] - epoch).toSeconds();
+    }
+    fout.seekp(offsets[0] + first * static_cast<std::int64_t>(sizeof(std::int64_t)));
+    fout.write(reinterpret_cast<const char *>(secs.data()), mynobs * sizeof(std::int64_t));
+    fout.seekp(offsets[1] + first * static_cast<std::int64_t>(sizeof(double)));
+    fout.write(reinterpret_cast<const char *>(locations_.data()), mynobs * sizeof(double));
+    for (size_t jc = 0; jc < order.size(); ++jc) {
+      fout.seekp(offsets[jc + 2] + first * static_cast<std::int64_t>(sizeof(double)));
+      fout.write(reinterpret_cast<const char *>(columns_[order[jc]].data()),
+                 mynobs * sizeof(double));
+    }
+    if (!fout) ABORT("ObsTable::otWriteBinary: Error writing file: " + filename);
+  }
+  comm_.barrier();
+
+  oops::Log::trace() << "ObsTable::otWriteBinary done" << std::endl;
+}
+
 // -----------------------------------------------------------------------------
 ObsIterator ObsTable::begin() const {
   return ObsIterator(locations_, 0);
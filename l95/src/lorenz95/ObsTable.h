@@ -11,10 +11,11 @@
 #ifndef LORENZ95_OBSTABLE_H_
 #define LORENZ95_OBSTABLE_H_
 
+#include <deque>
 #include <fstream>
-#include <map>
 #include <ostream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "eckit/mpi/Comm.h"
@@ -23,6 +24,7 @@
 #include "oops/util/DateTime.h"
 #include "oops/util/ObjectCounter.h"
 #include "oops/util/parameters/OptionalParameter.h"
+#include "oops/util/parameters/Parameter.h"
 #include "oops/util/parameters/Parameters.h"
 #include "oops/util/parameters/RequiredParameter.h"
 
@@ -37,6 +39,8 @@ class ObsDataParameters : public oops::Parameters {
  public:
   /// File path and file type
   oops::RequiredParameter<std::string> obsfile{"obsfile", this};
+  /// Write a binary columnar file instead of text (input files are recognised automatically)
+  oops::Parameter<bool> binary{"binary", false, this};
 };
 // -----------------------------------------------------------------------------
 /// Contents of the `obsdatain` or `obsdataout` YAML section.
@@ -98,6 +102,11 @@ class ObsTable : public oops::ObsSpaceBase,
   void getdb(const std::string &, std::vector<int> &) const;
   void getdb(const std::string &, std::vector<float> &) const;
   void getdb(const std::string &, std::vector<double> &) const;
+  /// Read-only access to a column, without the copy made by getdb
+  const std::vector<double> & column(const std::string &) const;
+  /// Index of a column, for repeated access without looking up its name
+  size_t columnIndex(const std::string &) const;
+  const std::vector<double> & column(const size_t icol) const {return columns_[icol];}
 
   bool has(const std::string & col) const;
   void generateDistribution(const ObsGenerateParameters & params);
@@ -118,19 +127,26 @@ class ObsTable : public oops::ObsSpaceBase,
   void print(std::ostream &) const;
   void otOpen(const std::string &);
   void otWrite(const std::string &) const;
+  void otOpenBinary(const std::string &);
+  void otWriteBinary(const std::string &) const;
+  std::vector<size_t> sortedColumns() const;
 
   const util::DateTime winbgn_;
   const util::DateTime winend_;
 
   std::vector<util::DateTime> times_;
   std::vector<double> locations_;
-  mutable std::map<std::string, std::vector<double> > data_;
+// Column store: values of each column, names and index by name
+  mutable std::deque<std::vector<double> > columns_;
+  mutable std::vector<std::string> colnames_;
+  mutable std::unordered_map<std::string, size_t> colindex_;
 
   const eckit::mpi::Comm & comm_;
   const oops::Variables obsvars_;
   const oops::Variables assimvars_;
   std::string nameIn_;
   std::string nameOut_;
+  bool binaryOut_ = false;
   const std::string obsname_ = "Lorenz 95";
 };
 // -----------------------------------------------------------------------------
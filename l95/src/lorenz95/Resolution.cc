@@ -9,18 +9,55 @@
  */
 
 #include "lorenz95/Resolution.h"
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <vector>
 
+#include "eckit/exception/Exceptions.h"
+
 // -----------------------------------------------------------------------------
 namespace lorenz95 {
 // -----------------------------------------------------------------------------
+Resolution::Resolution(const int resol, const eckit::mpi::Comm & comm)
+  : resol_(resol), comm_(comm), istart_(0), nlocal_(resol)
+{
+// Gridpoints are split in contiguous blocks, the halo needed by the model (two points
+// to the west, one to the east) must fit in a single neighbouring block.
+  const size_t ntasks = comm_.size();
+  ASSERT(ntasks == 1 || resol_ >= 2 * static_cast<int>(ntasks));
+  istart_ = this->istart(comm_.rank());
+  nlocal_ = this->istart(comm_.rank() + 1) - istart_;
+}
+// -----------------------------------------------------------------------------
+int Resolution::istart(const size_t task) const {
+  const int ntasks = comm_.size();
+  const int jt = static_cast<int>(task);
+  return jt * (resol_ / ntasks) + std::min(jt, resol_ % ntasks);
+}
+// -----------------------------------------------------------------------------
+int Resolution::owner(const int ii) const {
+  ASSERT(ii >= 0 && ii < resol_);
+  const int ntasks = comm_.size();
+  const int base = resol_ / ntasks;
+  const int rem = resol_ % ntasks;
+  const int split = rem * (base + 1);
+  if (ii < split) return ii / (base + 1);
+  return rem + (ii - split) / base;
+}
+// -----------------------------------------------------------------------------
+int Resolution::closestTask(const double lat, const double lon) const {
+  int ii = std::round(lon * resol_);
+  if (ii >= resol_) ii = 0;
+  return this->owner(ii);
+}
+// -----------------------------------------------------------------------------
 Iterator Resolution::begin() const {
   return Iterator(*this, 0);
 }
 // -----------------------------------------------------------------------------
 Iterator Resolution::end() const {
-  return Iterator(*this, resol_);
+  return Iterator(*this, nlocal_);
 }
 // -----------------------------------------------------------------------------
 std::vector<double> Resolution::verticalCoord(std::string & vcUnits) const {
@@ -35,10 +72,10 @@ std::vector<size_t> Resolution::variableSizes(const oops::Variables & vars) cons
 // -----------------------------------------------------------------------------
 void Resolution::latlon(std::vector<double> & lats, std::vector<double> & lons, const bool) const {
   const double dx = 1.0 / static_cast<double>(resol_);
-  lats.resize(resol_);
-  lons.resize(resol_);
-  for (size_t jj = 0; jj < (size_t)resol_; ++jj) {
-    lons[jj] = static_cast<double>(jj) * dx;
+  lats.resize(nlocal_);
+  lons.resize(nlocal_);
+  for (size_t jj = 0; jj < (size_t)nlocal_; ++jj) {
+    lons[jj] = static_cast<double>(istart_ + jj) * dx;
     lats[jj] = 0.0;
   }
 }
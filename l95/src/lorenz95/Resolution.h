@@ -47,12 +47,17 @@ class Resolution : public util::Printable {
   typedef ResolutionParameters Parameters_;
 
   Resolution(const ResolutionParameters & parameters, const eckit::mpi::Comm & comm)
-              : resol_(parameters.resol), comm_(comm)
-    {ASSERT(comm_.size() == 1);}
-  explicit Resolution(const int resol): resol_(resol), comm_(oops::mpi::myself())
-    {ASSERT(comm_.size() == 1);}
+    : Resolution(parameters.resol, comm) {}
+  explicit Resolution(const int resol, const eckit::mpi::Comm & comm = oops::mpi::myself());
 
+/// Global number of gridpoints
   int npoints() const {return resol_;}
+/// Block of gridpoints owned by this task
+  int nlocal() const {return nlocal_;}
+  int istart() const {return istart_;}
+  int istart(const size_t task) const;
+  int owner(const int ii) const;
+  int closestTask(const double lat, const double lon) const;
 
   Iterator begin() const;
   Iterator end() const;
@@ -68,6 +73,8 @@ class Resolution : public util::Printable {
   void print(std::ostream & os) const {os << resol_;}
   const int resol_;
   const eckit::mpi::Comm & comm_;
+  int istart_;
+  int nlocal_;
   atlas::FunctionSpace nospace_;
   atlas::FieldSet nofields_;
 };
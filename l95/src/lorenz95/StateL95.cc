@@ -102,6 +102,14 @@ void StateL95::read(const Parameters_ & parameters) {
   std::string filename(parameters.filename.value().value());
   sf::swapNameMember(parameters.member.value(), filename);
   oops::Log::trace() << "StateL95::read opening " << filename << std::endl;
+  if (FieldL95::isBinary(filename)) {
+    util::DateTime tt;
+    fld_.readBinary(filename, tt, parameters.memoryMap);
+    if (time_ != tt) {
+      ABORT("StateL95::read: date and data file inconsistent.");
+    }
+    return;
+  }
   std::ifstream fin(filename.c_str());
   if (!fin.is_open()) ABORT("StateL95::read: Error opening file: " + filename);
 
@@ -139,17 +147,28 @@ void StateL95::write(const WriteParameters_ & parameters) const {
 
   sf::swapNameMember(parameters.member.value(), filename);
 
-  oops::Log::trace() << "StateL95::write opening " << filename << std::endl;
-  std::ofstream fout(filename.c_str());
-  if (!fout.is_open()) ABORT("StateL95::write: Error opening file: " + filename);
+  if (parameters.binary) {
+    oops::Log::trace() << "StateL95::write binary file " << filename << std::endl;
+    fld_.writeBinary(filename, time_);
+    return;
+  }
 
-  fout << fld_.resol() << std::endl;
-  fout << time_ << std::endl;
+// Only task 0 opens the file, all tasks take part in gathering the field
+  const bool root = (fld_.comm().rank() == 0);
+  std::ofstream fout;
+  if (root) {
+    oops::Log::trace() << "StateL95::write opening " << filename << std::endl;
+    fout.open(filename.c_str());
+    if (!fout.is_open()) ABORT("StateL95::write: Error opening file: " + filename);
+    fout << fld_.resol() << std::endl;
+    fout << time_ << std::endl;
+  }
   fld_.write(fout);
-  fout << std::endl;
-
-  fout.close();
-  oops::Log::trace() << "StateL95::write file closed." << std::endl;
+  if (root) {
+    fout << std::endl;
+    fout.close();
+    oops::Log::trace() << "StateL95::write file closed." << std::endl;
+  }
 }
 // -----------------------------------------------------------------------------
 void StateL95::print(std::ostream & os) const {
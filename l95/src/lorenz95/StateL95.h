@@ -54,6 +54,8 @@ class StateL95Parameters : public oops::Parameters {
   oops::OptionalParameter<Field95GenerateParameters> analyticInit{"analytic init", this};
   /// \brief Ensemble member index.
   oops::OptionalParameter<int> member{"member", this};
+  /// \brief Memory-map binary files instead of reading them through a stream.
+  oops::Parameter<bool> memoryMap{"memory map", false, this};
 };
 
 // -----------------------------------------------------------------------------
@@ -64,6 +66,8 @@ class StateL95WriteParameters : public oops::WriteParametersBase {
 
  public:
   oops::Parameter<std::string> datadir{"datadir", ".", this};
+  /// \brief Write a binary file instead of text.
+  oops::Parameter<bool> binary{"binary", false, this};
 };
 
 /// L95 model state
@@ -96,7 +100,7 @@ class StateL95 : public util::Printable,
   const FieldL95 & getField() const {return fld_;}
   FieldL95 & getField() {return fld_;}
   std::shared_ptr<const Resolution> geometry() const {
-    std::shared_ptr<const Resolution> geom(new Resolution(fld_.resol()));
+    std::shared_ptr<const Resolution> geom(new Resolution(fld_.resol(), fld_.comm()));
     return geom;
   }
 
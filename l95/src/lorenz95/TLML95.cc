@@ -10,6 +10,8 @@
 
 #include "lorenz95/TLML95.h"
 
+#include <vector>
+
 #include "eckit/config/LocalConfiguration.h"
 #include "eckit/exception/Exceptions.h"
 
@@ -27,6 +29,7 @@
 #include "lorenz95/ModelTrajectory.h"
 #include "lorenz95/Resolution.h"
 #include "lorenz95/StateL95.h"
+#include "lorenz95/WorkSpaceGuard.h"
 
 
 namespace lorenz95 {
@@ -37,7 +40,7 @@ TLML95::TLML95(const Resolution & resol, const Parameters_ & params)
   : resol_(resol), tstep_(params.tstep),
     dt_(tstep_.toSeconds()/432000.0), traj_(),
     lrmodel_(resol_, params.trajectory),
-    vars_()
+    vars_(), inUse_(false), dx_(resol_), zz_(resol_), dz_(resol_), ext_(), trj_()
 {
   oops::Log::info() << "TLML95: resol = " << resol_ << ", tstep = " << tstep_ << std::endl;
   oops::Log::trace() << "TLML95::TLML95 created" << std::endl;
@@ -76,67 +79,75 @@ void TLML95::initializeAD(IncrementL95 &) const {}
 void TLML95::finalizeAD(IncrementL95 &) const {}
 // -----------------------------------------------------------------------------
 void TLML95::stepTL(IncrementL95 & xx, const ModelBiasCorrection & bias) const {
-  FieldL95 dx(xx.getField(), false);
-  FieldL95 zz(xx.getField(), false);
-  FieldL95 dz(xx.getField(), false);
+  const WorkSpaceGuard guard(inUse_, classname());
   const ModelTrajectory * traj = this->getTrajectory(xx.validTime());
+  const int nn = xx.getField().nlocal();
+  std::vector<double> & xv = xx.getField().asVector();
+  std::vector<double> & dx = dx_.asVector();
+  std::vector<double> & zz = zz_.asVector();
+  const std::vector<double> & dz = dz_.asVector();
+
+  zz_ = xx.getField();
+  this->tendenciesTL(zz_, bias.bias(), traj->get(1), dz_);
+  for (int jj = 0; jj < nn; ++jj) {
+    dx[jj] = dz[jj];
+    zz[jj] = xv[jj] + 0.5 * dz[jj];
+  }
 
-  zz = xx.getField();
-  this->tendenciesTL(zz, bias.bias(), traj->get(1), dz);
-  dx = dz;
-
-  zz = xx.getField();
-  zz.axpy(0.5, dz);
-  this->tendenciesTL(zz, bias.bias(), traj->get(2), dz);
-  dx.axpy(2.0, dz);
-
-  zz = xx.getField();
-  zz.axpy(0.5, dz);
-  this->tendenciesTL(zz, bias.bias(), traj->get(3), dz);
-  dx.axpy(2.0, dz);
+  this->tendenciesTL(zz_, bias.bias(), traj->get(2), dz_);
+  for (int jj = 0; jj < nn; ++jj) {
+    dx[jj] += 2.0 * dz[jj];
+    zz[jj] = xv[jj] + 0.5 * dz[jj];
+  }
 
-  zz = xx.getField();
-  zz += dz;
-  this->tendenciesTL(zz, bias.bias(), traj->get(4), dz);
-  dx += dz;
+  this->tendenciesTL(zz_, bias.bias(), traj->get(3), dz_);
+  for (int jj = 0; jj < nn; ++jj) {
+    dx[jj] += 2.0 * dz[jj];
+    zz[jj] = xv[jj] + dz[jj];
+  }
 
+  this->tendenciesTL(zz_, bias.bias(), traj->get(4), dz_);
   const double zt = 1.0/6.0;
-  xx.getField().axpy(zt, dx);
+  for (int jj = 0; jj < nn; ++jj) xv[jj] += zt * (dx[jj] + dz[jj]);
   xx.validTime() += tstep_;
 }
 // -----------------------------------------------------------------------------
 void TLML95::stepAD(IncrementL95 & xx, ModelBiasCorrection & bias) const {
-  FieldL95 dx(xx.getField(), false);
-  FieldL95 zz(xx.getField(), false);
-  FieldL95 dz(xx.getField(), false);
-
+  const WorkSpaceGuard guard(inUse_, classname());
   xx.validTime() -= tstep_;
   const ModelTrajectory * traj = this->getTrajectory(xx.validTime());
+  const int nn = xx.getField().nlocal();
+  std::vector<double> & xv = xx.getField().asVector();
+  std::vector<double> & dx = dx_.asVector();
+  const std::vector<double> & zz = zz_.asVector();
+  std::vector<double> & dz = dz_.asVector();
 
   const double zt = 1.0/6.0;
-  dx = xx.getField();
-  dx *= zt;
-
-  dz = dx;
-  this->tendenciesAD(zz, bias.bias(), traj->get(4), dz);
-  xx.getField() += zz;
-  dz = zz;
-
-  dz.axpy(2.0, dx);
-  this->tendenciesAD(zz, bias.bias(), traj->get(3), dz);
-  xx.getField() += zz;
-  dz = zz;
-  dz *= 0.5;
-
-  dz.axpy(2.0, dx);
-  this->tendenciesAD(zz, bias.bias(), traj->get(2), dz);
-  xx.getField() += zz;
-  dz = zz;
-  dz *= 0.5;
-
-  dz += dx;
-  this->tendenciesAD(zz, bias.bias(), traj->get(1), dz);
-  xx.getField() += zz;
+  for (int jj = 0; jj < nn; ++jj) {
+    dx[jj] = zt * xv[jj];
+    dz[jj] = dx[jj];
+  }
+
+  this->tendenciesAD(zz_, bias.bias(), traj->get(4), dz_);
+  for (int jj = 0; jj < nn; ++jj) {
+    xv[jj] += zz[jj];
+    dz[jj] = zz[jj] + 2.0 * dx[jj];
+  }
+
+  this->tendenciesAD(zz_, bias.bias(), traj->get(3), dz_);
+  for (int jj = 0; jj < nn; ++jj) {
+    xv[jj] += zz[jj];
+    dz[jj] = 0.5 * zz[jj] + 2.0 * dx[jj];
+  }
+
+  this->tendenciesAD(zz_, bias.bias(), traj->get(2), dz_);
+  for (int jj = 0; jj < nn; ++jj) {
+    xv[jj] += zz[jj];
+    dz[jj] = 0.5 * zz[jj] + dx[jj];
+  }
+
+  this->tendenciesAD(zz_, bias.bias(), traj->get(1), dz_);
+  for (int jj = 0; jj < nn; ++jj) xv[jj] += zz[jj];
 }
 // -----------------------------------------------------------------------------
 // intel 19 tries to aggressive optimize these functions in a way that leads
@@ -146,40 +157,40 @@ void TLML95::stepAD(IncrementL95 & xx, ModelBiasCorrection & bias) const {
 #endif
 void TLML95::tendenciesTL(const FieldL95 & xx, const double & bias,
                           const FieldL95 & xtraj, FieldL95 & dx) const {
-  const int nn = resol_.npoints();
+  const int nn = xx.nlocal();
+  xx.extend(ext_, 2, 1);
+  xtraj.extend(trj_, 2, 1);
+  const double * ext = ext_.data();
+  const double * trj = trj_.data();
   for (int jj = 0; jj < nn; ++jj) {
-    int jm2 = jj - 2;
-    int jm1 = jj - 1;
-    int jp1 = jj + 1;
-    if (jm2 < 0) jm2 += nn;
-    if (jm1 < 0) jm1 += nn;
-    if (jp1 >= nn) jp1 -= nn;
-    const double dxdt = - xx[jm2] * xtraj[jm1] - xtraj[jm2] * xx[jm1]
-                        + xx[jm1] * xtraj[jp1] + xtraj[jm1] * xx[jp1]
-                        - xx[jj] - bias;
+    const double dxdt = - ext[jj] * trj[jj+1] - trj[jj] * ext[jj+1]
+                        + ext[jj+1] * trj[jj+3] + trj[jj+1] * ext[jj+3]
+                        - ext[jj+2] - bias;
     dx[jj] = dt_ * dxdt;
   }
 }
 // -----------------------------------------------------------------------------
 void TLML95::tendenciesAD(FieldL95 & xx, double & bias,
                           const FieldL95 & xtraj, const FieldL95 & dx) const {
-  const int nn = resol_.npoints();
-  xx.zero();
+  const int nn = xx.nlocal();
+  xtraj.extend(trj_, 2, 1);
+  const double * trj = trj_.data();
+  ext_.assign(nn + 3, 0.0);
+  double * ext = ext_.data();
+  double zbias = 0.0;
   for (int jj = 0; jj < nn; ++jj) {
-    int jm2 = jj - 2;
-    int jm1 = jj - 1;
-    int jp1 = jj + 1;
-    if (jm2 < 0) jm2 += nn;
-    if (jm1 < 0) jm1 += nn;
-    if (jp1 >= nn) jp1 -= nn;
     const double dxdt = dt_ * dx[jj];
-    xx[jm2] -= dxdt * xtraj[jm1];
-    xx[jm1] -= dxdt * xtraj[jm2];
-    xx[jm1] += dxdt * xtraj[jp1];
-    xx[jp1] += dxdt * xtraj[jm1];
-    xx[jj] -= dxdt;
-    bias -= dxdt;
+    ext[jj] -= dxdt * trj[jj+1];
+    ext[jj+1] -= dxdt * trj[jj];
+    ext[jj+1] += dxdt * trj[jj+3];
+    ext[jj+3] += dxdt * trj[jj+1];
+    ext[jj+2] -= dxdt;
+    zbias -= dxdt;
   }
+  xx.zero();
+  xx.extendAD(ext_, 2, 1);
+  xx.comm().allReduceInPlace(zbias, eckit::mpi::Operation::SUM);
+  bias += zbias;
 }
 #ifdef __INTEL_COMPILER
 #pragma optimize("", on)
@@ -11,9 +11,11 @@
 #ifndef LORENZ95_TLML95_H_
 #define LORENZ95_TLML95_H_
 
+#include <atomic>
 #include <map>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include <boost/noncopyable.hpp>
 
@@ -23,6 +25,7 @@
 #include "oops/util/ObjectCounter.h"
 #include "oops/util/Printable.h"
 
+#include "lorenz95/FieldL95.h"
 #include "lorenz95/L95Traits.h"
 #include "lorenz95/ModelL95.h"
 
@@ -36,7 +39,6 @@ namespace util {
 }
 
 namespace lorenz95 {
-  class FieldL95;
 
 // -----------------------------------------------------------------------------
 
@@ -97,6 +99,14 @@ class TLML95: public oops::interface::LinearModelBase<L95Traits>,
   std::map< util::DateTime, ModelTrajectory * > traj_;
   const ModelL95 lrmodel_;
   const oops::Variables vars_;
+// Work space reused by every time step: steps of one model must not run concurrently
+// (checked with inUse_, see WorkSpaceGuard)
+  mutable std::atomic<bool> inUse_;
+  mutable FieldL95 dx_;
+  mutable FieldL95 zz_;
+  mutable FieldL95 dz_;
+  mutable std::vector<double> ext_;
+  mutable std::vector<double> trj_;
 };
 
 // -----------------------------------------------------------------------------
@@ -0,0 +1,44 @@
+/*
+ * (C) Copyright 2026 UCAR.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#ifndef LORENZ95_WORKSPACEGUARD_H_
+#define LORENZ95_WORKSPACEGUARD_H_
+
+#include <atomic>
+#include <string>
+
+#include "eckit/exception/Exceptions.h"
+
+namespace lorenz95 {
+
+// -----------------------------------------------------------------------------
+/// Marks the work space owned by a model as in use for the duration of a time step.
+/// The work space is shared by all steps of that model, so steps of one model object must
+/// not run concurrently (e.g. from several threads): this is checked here.
+
+class WorkSpaceGuard {
+ public:
+  WorkSpaceGuard(std::atomic<bool> & inUse, const std::string & owner): inUse_(inUse) {
+    if (inUse_.exchange(true)) {
+      throw eckit::SeriousBug(owner + ": concurrent time steps would share the work space",
+                              Here());
+    }
+  }
+  ~WorkSpaceGuard() {inUse_ = false;}
+
+  WorkSpaceGuard(const WorkSpaceGuard &) = delete;
+  WorkSpaceGuard & operator=(const WorkSpaceGuard &) = delete;
+
+ private:
+  std::atomic<bool> & inUse_;
+};
+
+// -----------------------------------------------------------------------------
+
+}  // namespace lorenz95
+
+#endif  // LORENZ95_WORKSPACEGUARD_H_
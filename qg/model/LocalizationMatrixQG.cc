@@ -10,6 +10,8 @@
 
 #include "model/LocalizationMatrixQG.h"
 
+#include <vector>
+
 #include "eckit/config/Configuration.h"
 #include "model/GeometryQG.h"
 #include "model/IncrementQG.h"
@@ -37,6 +39,14 @@ void LocalizationMatrixQG::multiply(IncrementQG & dx) const {
   qg_error_covariance_mult_f90(keyLocal_, dxtmp.fields().toFortran(), dx.fields().toFortran());
 }
 // -----------------------------------------------------------------------------
+void LocalizationMatrixQG::multiplyEnsemble(const std::vector<IncrementQG *> & dxs) const {
+  std::vector<F90flds> keys;
+  keys.reserve(dxs.size());
+  for (const IncrementQG * dx : dxs) keys.push_back(dx->fields().toFortran());
+  const int nflds = keys.size();
+  qg_error_covariance_mult_multi_f90(keyLocal_, nflds, keys.data());
+}
+// -----------------------------------------------------------------------------
 void LocalizationMatrixQG::print(std::ostream & os) const {
   os << "LocalizationMatrixQG::print not implemented";
 }
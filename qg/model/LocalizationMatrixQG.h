@@ -43,6 +43,8 @@ class LocalizationMatrixQG: public oops::interface::LocalizationBase<qg::QgTrait
 
   void randomize(IncrementQG &) const override;
   void multiply(IncrementQG &) const override;
+  void multiplyEnsemble(const std::vector<IncrementQG *> &) const override;
+  bool hasBatchedMultiply() const override {return true;}
 
  private:
   void print(std::ostream &) const override;
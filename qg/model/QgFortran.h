@@ -79,6 +79,8 @@ extern "C" {
                                      const F90geom &);
   void qg_error_covariance_delete_f90(F90error_covariance &);
   void qg_error_covariance_mult_f90(const F90error_covariance &, const F90flds &, const F90flds &);
+  void qg_error_covariance_mult_multi_f90(const F90error_covariance &, const int &,
+                                          const F90flds *);
   void qg_error_covariance_inv_mult_f90(const F90error_covariance &, const F90flds &,
                                         const F90flds &);
   void qg_error_covariance_randomize_f90(const F90error_covariance &, const F90flds &);
@@ -16,16 +16,23 @@
 // -----------------------------------------------------------------------------
 namespace qg {
 // -----------------------------------------------------------------------------
+namespace {
+/// FFT plans are created on first use and reused by all transforms of the calling thread
+Eigen::FFT<double> & threadFFT() {
+  static thread_local Eigen::FFT<double> fft;
+  return fft;
+}
+}  // namespace
+// -----------------------------------------------------------------------------
 
 void fft_fwd_f(const int & kk, const double * xx, double * ff) {
-  static Eigen::FFT<double> fft;
   std::vector<double> grid(kk);
   const unsigned int size = kk/2+1;
   std::vector<std::complex<double> > coefs(size);
 
   for (int jj = 0; jj < kk; ++jj) grid[jj] = xx[jj];
 
-  fft.fwd(coefs, grid);
+  threadFFT().fwd(coefs, grid);
 
   for (unsigned int jj = 0; jj < size; ++jj) {
     ff[2*jj]   = coefs[jj].real();
@@ -36,7 +43,6 @@ void fft_fwd_f(const int & kk, const double * xx, double * ff) {
 // -----------------------------------------------------------------------------
 
 void fft_inv_f(const int & kk, const double * ff, double * xx) {
-  static Eigen::FFT<double> fft;
   std::vector<double> grid(kk);
   std::vector<std::complex<double> > coefs(kk);
 
@@ -48,11 +54,27 @@ void fft_inv_f(const int & kk, const double * ff, double * xx) {
   }
   for (int jj = size; jj < kk; ++jj) coefs[jj] = zero;
 
-  fft.inv(grid, coefs);
+  threadFFT().inv(grid, coefs);
 
   for (int jj = 0; jj < kk; ++jj) xx[jj] = grid[jj];
 }
 
 // -----------------------------------------------------------------------------
 
+void fft_fwd_batch_f(const int & kk, const int & nn, const double * xx, double * ff) {
+  for (int jn = 0; jn < nn; ++jn) {
+    fft_fwd_f(kk, xx + static_cast<size_t>(jn)*kk, ff + static_cast<size_t>(jn)*(kk+2));
+  }
+}
+
+// -----------------------------------------------------------------------------
+
+void fft_inv_batch_f(const int & kk, const int & nn, const double * ff, double * xx) {
+  for (int jn = 0; jn < nn; ++jn) {
+    fft_inv_f(kk, ff + static_cast<size_t>(jn)*(kk+2), xx + static_cast<size_t>(jn)*kk);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
 }  // namespace qg
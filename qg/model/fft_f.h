@@ -12,6 +12,8 @@ namespace qg {
 extern "C" {
   void fft_fwd_f(const int &, const double *, double *);
   void fft_inv_f(const int &, const double *, double *);
+  void fft_fwd_batch_f(const int &, const int &, const double *, double *);
+  void fft_inv_batch_f(const int &, const int &, const double *, double *);
 }
 }  // namespace qg
 
@@ -0,0 +1,16 @@
+/*
+ * (C) Copyright 2026 UCAR
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#include "model/QgTraits.h"
+#include "oops/runs/Run.h"
+#include "test/interface/UnstructuredInterpolator.h"
+
+int main(int argc,  char ** argv) {
+  oops::Run run(argc, argv);
+  test::UnstructuredInterpolator<qg::QgTraits> tests;
+  return run.execute(tests);
+}
@@ -11,6 +11,7 @@
 #ifndef OOPS_BASE_ENSEMBLECOVARIANCE_H_
 #define OOPS_BASE_ENSEMBLECOVARIANCE_H_
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -31,6 +32,7 @@
 #include "oops/util/Logger.h"
 #include "oops/util/ObjectCounter.h"
 #include "oops/util/Timer.h"
+#include "oops/util/parameters/Parameter.h"
 
 namespace oops {
 
@@ -44,6 +46,8 @@ class EnsembleCovarianceParameters : public ModelSpaceCovarianceParametersBase<M
   IncrementEnsembleFromStatesParameters<MODEL> ensemble{this};
   oops::OptionalParameter<eckit::LocalConfiguration> localization{"localization",
                          "localization applied to ensemble covariances", this};
+  /// Maximum number of members localized together, when the localization supports it.
+  oops::Parameter<size_t> localizationBatchSize{"localization batch size", 8, this};
 };
 
 /// Generic ensemble based model space error covariance.
@@ -75,6 +79,7 @@ class EnsembleCovariance : public ModelSpaceCovarianceBase<MODEL>,
 
   EnsemblePtr_ ens_;
   std::unique_ptr<Localization_> loc_;
+  const size_t locBatchSize_;
   int seed_ = 7;  // For reproducibility
 };
 
@@ -86,10 +91,12 @@ template<typename MODEL>
 EnsembleCovariance<MODEL>::EnsembleCovariance(const Geometry_ & resol, const Variables & vars,
                                               const Parameters_ & params,
                                               const State_ & xb, const State_ & fg)
-  : ModelSpaceCovarianceBase<MODEL>(resol, params, xb, fg), ens_(), loc_()
+  : ModelSpaceCovarianceBase<MODEL>(resol, params, xb, fg), ens_(), loc_(),
+    locBatchSize_(params.localizationBatchSize)
 {
   Log::trace() << "EnsembleCovariance::EnsembleCovariance start" << std::endl;
   util::Timer timer("oops::Covariance", "EnsembleCovariance");
+  ASSERT(locBatchSize_ > 0);
   size_t init = eckit::system::ResourceUsage().maxResidentSetSize();
   ens_.reset(new Ensemble_(params.ensemble, xb, fg, resol, vars));
   if (params.localization.value() != boost::none) {
@@ -129,16 +136,32 @@ void EnsembleCovariance<MODEL>::doRandomize(Increment_ & dx) const {
 template<typename MODEL>
 void EnsembleCovariance<MODEL>::doMultiply(const Increment_ & dxi, Increment_ & dxo) const {
   dxo.zero();
-  for (unsigned int ie = 0; ie < ens_->size(); ++ie) {
-    if (loc_) {
-      // Localized covariance matrix
-      Increment_ dx(dxi);
-      dx.schur_product_with((*ens_)[ie]);
-      loc_->multiply(dx);
-      dx.schur_product_with((*ens_)[ie]);
-      dxo.axpy(1.0, dx, false);
-    } else {
-      // Raw covariance matrix
+  if (loc_) {
+    // Localized covariance matrix. Members go through the localization in batches of
+    // bounded size when it processes them together, one at a time otherwise.
+    const size_t nbatch = loc_->hasBatchedMultiply() ? locBatchSize_ : 1;
+    std::vector<Increment_> dxs;
+    dxs.reserve(nbatch);
+    for (size_t ie0 = 0; ie0 < ens_->size(); ie0 += nbatch) {
+      const size_t ie1 = std::min(ie0 + nbatch, ens_->size());
+      dxs.clear();
+      for (size_t ie = ie0; ie < ie1; ++ie) {
+        dxs.emplace_back(dxi);
+        dxs.back().schur_product_with((*ens_)[ie]);
+      }
+      if (dxs.size() > 1) {
+        loc_->multiplyEnsemble(dxs);
+      } else {
+        loc_->multiply(dxs[0]);
+      }
+      for (size_t ie = ie0; ie < ie1; ++ie) {
+        dxs[ie - ie0].schur_product_with((*ens_)[ie]);
+        dxo.axpy(1.0, dxs[ie - ie0], false);
+      }
+    }
+  } else {
+    // Raw covariance matrix
+    for (unsigned int ie = 0; ie < ens_->size(); ++ie) {
       double wgt = dxi.dot_product_with((*ens_)[ie]);
       dxo.axpy(wgt, (*ens_)[ie], false);
     }
@@ -7,6 +7,19 @@
 
 #include "oops/base/GeometryData.h"
 
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "eckit/exception/Exceptions.h"
+
 #include "oops/external/stripack/stripack.h"
 #include "oops/mpi/mpi.h"
 #include "oops/util/Logger.h"
@@ -57,13 +70,6 @@ bool GeometryData::containingTriangleAndBarycentricCoords(const double lat, cons
     std::array<int, 3> & indices, std::array<double, 3> & baryCoords) const {
   ASSERT(loctree_);
 
-  // Initialize Triangulation on first use
-  if (triangulation_ == nullptr) {
-    ASSERT(lats_.size() > 0);  // check temporary coord buffers were initialized
-    ASSERT(lats_.size() == lons_.size());
-    triangulation_.reset(new stripack::Triangulation(lats_, lons_));
-  }
-
   atlas::PointLonLat ptll(lon, lat);
   ptll.normalise();
   atlas::Point3 pt3;
@@ -73,13 +79,71 @@ bool GeometryData::containingTriangleAndBarycentricCoords(const double lat, cons
   // Index of closest neighbor in source-point list
   const int guessIndex = localTree_.closestPoint(ptll).payload();
 
-  const bool validTriangle = triangulation_->containingTriangleAndBarycentricCoords(
+  const bool validTriangle = triangulation().containingTriangleAndBarycentricCoords(
       coords, guessIndex, indices, baryCoords);
   return validTriangle;
 }
 
 // -----------------------------------------------------------------------------
 
+const stripack::Triangulation & GeometryData::triangulation() const {
+  // Initialize Triangulation on first use (possibly from several threads)
+  std::call_once(triangulationFlag_, [this]() {
+    util::Timer timer("oops::GeometryData", "triangulation");
+    ASSERT(lats_.size() > 0);  // check temporary coord buffers were initialized
+    ASSERT(lats_.size() == lons_.size());
+    const std::string cache = triangulationCacheFile();
+    if (!cache.empty()) triangulation_ = stripack::Triangulation::read(cache, lats_, lons_);
+    if (triangulation_ == nullptr) {
+      std::unique_ptr<stripack::Triangulation> tri(new stripack::Triangulation(lats_, lons_));
+      if (!cache.empty()) {
+        // Write to a task-specific file first: tasks with the same points share the cache file
+        // The cache is only an optimization: on failure, keep the triangulation built in memory
+        const std::string tmpfile = cache + "." + std::to_string(oops::mpi::world().rank());
+        try {
+          tri->write(tmpfile);
+          if (std::rename(tmpfile.c_str(), cache.c_str()) == 0) {
+            Log::info() << "GeometryData: saved triangulation to " << cache << std::endl;
+          } else {
+            std::remove(tmpfile.c_str());
+            Log::warning() << "GeometryData: could not rename " << tmpfile << " to " << cache
+                           << ", triangulation not cached" << std::endl;
+          }
+        } catch (eckit::Exception & e) {
+          std::remove(tmpfile.c_str());
+          Log::warning() << "GeometryData: could not save triangulation to " << cache << ": "
+                         << e.what() << std::endl;
+        }
+      }
+      triangulation_ = std::move(tri);
+    }
+  });
+  return *triangulation_;
+}
+
+// -----------------------------------------------------------------------------
+
+std::string GeometryData::triangulationCacheFile() const {
+  const char * dir = std::getenv("OOPS_TRIANGULATION_CACHE");
+  if (dir == nullptr || std::strlen(dir) == 0) return "";
+
+  // The triangulation depends on the local points (with halo), identified by a hash of their
+  // coordinates, and is read back only if built from the same points.
+  std::uint64_t hash = 14695981039346656037ULL;
+  for (const std::vector<double> * coords : {&lats_, &lons_}) {
+    const unsigned char * bytes = reinterpret_cast<const unsigned char *>(coords->data());
+    for (size_t jj = 0; jj < coords->size() * sizeof(double); ++jj) {
+      hash = (hash ^ bytes[jj]) * 1099511628211ULL;
+    }
+  }
+  std::ostringstream file;
+  file << dir << "/triangulation_" << std::hex << std::setw(16) << std::setfill('0') << hash
+       << std::dec << "_" << lats_.size() << ".bin";
+  return file.str();
+}
+
+// -----------------------------------------------------------------------------
+
 // Local tree requires lats and lons with halo
 void GeometryData::setLocalTree(const std::vector<double> & lats,
                                 const std::vector<double> & lons) {
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -53,6 +54,9 @@ class GeometryData {
   /// Returns true if such a triangle is found; false if not.
   bool containingTriangleAndBarycentricCoords(double lat, double lon,
       std::array<int, 3> & indices, std::array<double, 3> & barycentricCoords) const;
+  /// Builds (or reads) the triangulation, otherwise done on first call to the method above.
+  /// To be called before searching triangles from several threads.
+  void buildTriangulation() const {triangulation();}
 
 // Accessors
   const atlas::FunctionSpace & functionSpace() const {return fspace_;}
@@ -64,6 +68,9 @@ class GeometryData {
   bool levelsAreTopDown() const {return topdown_;}
 
  private:
+  const stripack::Triangulation & triangulation() const;
+  std::string triangulationCacheFile() const;
+
   atlas::FunctionSpace fspace_;
   atlas::FieldSet fset_;
   const eckit::mpi::Comm * comm_;
@@ -78,8 +85,10 @@ class GeometryData {
   const atlas::Geometry unitsphere_;
   std::vector<double> lats_;
   std::vector<double> lons_;
-  // Triangulation is a bit expensive (and not valid for models like L95), so compute on demand
+  // Triangulation is a bit expensive (and not valid for models like L95), so compute on demand.
+  // It is read from (or saved to) the directory given by OOPS_TRIANGULATION_CACHE if set.
   mutable std::unique_ptr<const stripack::Triangulation> triangulation_;
+  mutable std::once_flag triangulationFlag_;
 };
 
 // -----------------------------------------------------------------------------
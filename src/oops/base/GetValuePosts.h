@@ -14,6 +14,7 @@
 #include <utility>
 #include <vector>
 
+#include "oops/base/Geometry.h"
 #include "oops/base/GetValues.h"
 #include "oops/base/PostBase.h"
 #include "oops/base/State.h"
@@ -32,6 +33,9 @@ class GetValuesParameters : public oops::Parameters {
 
  public:
   Parameter<VarChangeParameters_> variableChange{"variable change", {}, this};
+  /// Exchange locations and interpolated values for all obs spaces together (one collective
+  /// and one message per neighbouring task) instead of separately for each obs space.
+  Parameter<bool> combineCommunications{"combine communications", false, this};
 };
 
 /// \brief Fills GeoVaLs with requested variables at requested locations during model run
@@ -46,6 +50,8 @@ class GetValuePosts : public PostBase<State<MODEL>> {
   explicit GetValuePosts(const GetValuesParameters<MODEL> &);
 
   void append(GetValuePtr_);
+/// \brief Exchanges locations for all GetValues at once (with combined communications)
+  void exchangeLocations(const Geometry<MODEL> &);
 
  private:
 /// \brief initialization before model run: sets up GetValues and allocate GeoVaLs
@@ -80,6 +86,16 @@ void GetValuePosts<MODEL, OBS>::append(GetValuePtr_ getval) {
 
 // -----------------------------------------------------------------------------
 
+template <typename MODEL, typename OBS>
+void GetValuePosts<MODEL, OBS>::exchangeLocations(const Geometry<MODEL> & geom) {
+  Log::trace() << "GetValuePosts::exchangeLocations start" << std::endl;
+  ASSERT(params_.combineCommunications);
+  GetValues<MODEL, OBS>::exchangeLocations(geom, getvals_);
+  Log::trace() << "GetValuePosts::exchangeLocations done" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
 template <typename MODEL, typename OBS>
 void GetValuePosts<MODEL, OBS>::doInitialize(const State_ &, const util::DateTime &,
                                              const util::Duration & tstep) {
@@ -109,7 +125,11 @@ void GetValuePosts<MODEL, OBS>::doProcessing(const State_ & xx) {
 template <typename MODEL, typename OBS>
 void GetValuePosts<MODEL, OBS>::doFinalize(const State_ &) {
   Log::trace() << "GetValuePosts::doFinalize start" << std::endl;
-  for (GetValuePtr_ getval : getvals_) getval->finalize();
+  if (params_.combineCommunications) {
+    GetValues<MODEL, OBS>::exchangeValues(getvals_);
+  } else {
+    for (GetValuePtr_ getval : getvals_) getval->finalize();
+  }
   Log::trace() << "GetValuePosts::doFinalize done" << std::endl;
 }
 
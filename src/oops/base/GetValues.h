@@ -100,7 +100,15 @@ class GetValues : private util::ObjectCounter<GetValues<MODEL, OBS> > {
 
   GetValues(const eckit::Configuration &, const Geometry_ &,
             const util::DateTime &, const util::DateTime &,
-            const Locations_ &, const Variables &, const Variables & varl = Variables());
+            const Locations_ &, const Variables &, const Variables & varl = Variables(),
+            const bool deferExchange = false);
+
+/// Combined communication for several GetValues (typically one per obs space): a single
+/// allToAll and one message per neighbouring task for all of them. GetValues constructed with
+/// \p deferExchange must go through exchangeLocations before use; exchangeValues replaces
+/// finalize (values are then ready for fillGeoVaLs).
+  static void exchangeLocations(const Geometry_ &, const std::vector<std::shared_ptr<GetValues>> &);
+  static void exchangeValues(const std::vector<std::shared_ptr<GetValues>> &);
 
 /// Nonlinear
   void initialize(const util::Duration &);
@@ -125,6 +133,10 @@ class GetValues : private util::ObjectCounter<GetValues<MODEL, OBS> > {
   const Variables & requiredVariables() const {return geovars_;}
 
  private:
+/// setup helpers: tasks exchanging obs with this task (from the numbers of values to send
+/// to and receive from each task), then interpolators for the received locations
+  void setTasks(const std::vector<int> &, const std::vector<int> &);
+  void setInterpolators(const Geometry_ &, const std::vector<std::vector<double>> &);
 /// time-interpolation helper: adds contribution from this time to running total
   void incInterpValues(const util::DateTime &, const std::vector<bool> &,
                        const size_t &, const std::vector<double> &);
@@ -142,11 +154,15 @@ class GetValues : private util::ObjectCounter<GetValues<MODEL, OBS> > {
   eckit::LocalConfiguration interpConf_;
   const eckit::mpi::Comm & comm_;
   const size_t ntasks_;
-  std::vector<std::unique_ptr<LocalInterp_>> interp_;
-  std::vector<std::vector<size_t>> myobs_index_by_task_;
-  std::vector<std::vector<util::DateTime>> obs_times_by_task_;
+  std::vector<size_t> interpTasks_;    /// tasks for which some obs are interpolated here
+  std::vector<std::unique_ptr<LocalInterp_>> interp_;  /// one per task in interpTasks_
+  std::vector<size_t> obsTasks_;       /// tasks interpolating some of the local obs
+  std::vector<std::vector<util::DateTime>> obs_times_by_task_;  /// one per task in interpTasks_
+  std::vector<std::vector<size_t>> myobs_index_by_task_;  /// local obs indices, one per task
+                                                          /// (in obsTasks_ once exchanged)
+  std::vector<std::vector<double>> myobs_locs_by_task_;   /// (until exchanged) obs locations
   std::vector<std::vector<double>> locinterp_;
-  std::vector<std::vector<double>> recvinterp_;
+  std::vector<std::vector<double>> recvinterp_;  /// one per task in obsTasks_
   std::vector<eckit::mpi::Request> send_req_;
   std::vector<eckit::mpi::Request> recv_req_;
   int tag_;
@@ -163,11 +179,13 @@ template <typename MODEL, typename OBS>
 GetValues<MODEL, OBS>::GetValues(const eckit::Configuration & conf, const Geometry_ & geom,
                                  const util::DateTime & bgn, const util::DateTime & end,
                                  const Locations_ & locs,
-                                 const Variables & vars, const Variables & varl)
+                                 const Variables & vars, const Variables & varl,
+                                 const bool deferExchange)
   : winbgn_(bgn), winend_(end), hslot_(), locations_(locs),
     geovars_(vars), varsizes_(0), linvars_(varl), linsizes_(0),
-    interpConf_(conf), comm_(geom.getComm()), ntasks_(comm_.size()), interp_(ntasks_),
-    myobs_index_by_task_(ntasks_), obs_times_by_task_(ntasks_),
+    interpConf_(conf), comm_(geom.getComm()), ntasks_(comm_.size()),
+    interpTasks_(), interp_(), obsTasks_(),
+    obs_times_by_task_(), myobs_index_by_task_(ntasks_), myobs_locs_by_task_(ntasks_),
     locinterp_(), recvinterp_(), send_req_(), recv_req_(), tag_(789),
     levelsTopDown_(geom.levelsAreTopDown()), geovarsSizes_(geom.variableSizes(geovars_))
 {
@@ -198,38 +216,230 @@ GetValues<MODEL, OBS>::GetValues(const eckit::Configuration & conf, const Geomet
   std::vector<double> obslons = locations_.longitudes();
   std::vector<util::DateTime> obstimes = locations_.times();
 
-// Exchange obs locations
-  std::vector<std::vector<double>> myobs_locs_by_task(ntasks_);
+// Group obs locations by the task that will interpolate them
   for (size_t jobs = 0; jobs < obstimes.size(); ++jobs) {
     const size_t itask = geom.closestTask(obslats[jobs], obslons[jobs]);
     myobs_index_by_task_[itask].push_back(jobs);
-    myobs_locs_by_task[itask].push_back(obslats[jobs]);
-    myobs_locs_by_task[itask].push_back(obslons[jobs]);
-    obstimes[jobs].serialize(myobs_locs_by_task[itask]);
+    myobs_locs_by_task_[itask].push_back(obslats[jobs]);
+    myobs_locs_by_task_[itask].push_back(obslons[jobs]);
+    obstimes[jobs].serialize(myobs_locs_by_task_[itask]);
+  }
+
+  if (!deferExchange) {
+//  Only tasks that have obs to exchange communicate: exchange sizes first
+    std::vector<int> nsend(ntasks_);
+    for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
+      nsend[jtask] = myobs_locs_by_task_[jtask].size();
+    }
+    std::vector<int> nrecv(ntasks_);
+    comm_.allToAll(nsend, nrecv);
+    this->setTasks(nsend, nrecv);
+
+//  Exchange obs locations
+    std::vector<std::vector<double>> mylocs_by_task;
+    for (const size_t jtask : interpTasks_) mylocs_by_task.emplace_back(nrecv[jtask]);
+
+    std::vector<eckit::mpi::Request> reqs;
+    for (size_t jj = 0; jj < interpTasks_.size(); ++jj) {
+      reqs.push_back(comm_.iReceive(mylocs_by_task[jj].data(), mylocs_by_task[jj].size(),
+                                    interpTasks_[jj], tag_));
+    }
+    for (const size_t jtask : obsTasks_) {
+      reqs.push_back(comm_.iSend(myobs_locs_by_task_[jtask].data(),
+                                 myobs_locs_by_task_[jtask].size(), jtask, tag_));
+    }
+    for (eckit::mpi::Request & req : reqs) {
+      eckit::mpi::Status st = comm_.wait(req);
+      ASSERT(st.error() == 0);
+    }
+
+    this->setInterpolators(geom, mylocs_by_task);
   }
 
-  std::vector<std::vector<double>> mylocs_by_task(ntasks_);
-  comm_.allToAll(myobs_locs_by_task, mylocs_by_task);
+  Log::trace() << "GetValues::GetValues done" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
 
-// Setup interpolators
+template <typename MODEL, typename OBS>
+void GetValues<MODEL, OBS>::setTasks(const std::vector<int> & nsend,
+                                     const std::vector<int> & nrecv) {
+  ASSERT(nsend.size() == ntasks_ && nrecv.size() == ntasks_);
+// Keep obs indices only for the tasks interpolating some of the local obs
+  std::vector<std::vector<size_t>> myobs_index;
+  for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
+    if (nsend[jtask] > 0) {
+      obsTasks_.push_back(jtask);
+      myobs_index.push_back(std::move(myobs_index_by_task_[jtask]));
+    }
+  }
   for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
+    if (nrecv[jtask] > 0) interpTasks_.push_back(jtask);
+  }
+  myobs_index_by_task_ = std::move(myobs_index);
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename MODEL, typename OBS>
+void GetValues<MODEL, OBS>::setInterpolators(const Geometry_ & geom,
+                                             const std::vector<std::vector<double>> & mylocs) {
+  ASSERT(mylocs.size() == interpTasks_.size());
+  interp_.resize(interpTasks_.size());
+  obs_times_by_task_.resize(interpTasks_.size());
+  for (size_t jtask = 0; jtask < interpTasks_.size(); ++jtask) {
     // The 4 below is because each loc holds lat + lon + 2 datetime ints
-    const size_t nobs = mylocs_by_task[jtask].size() / 4;
+    const size_t nobs = mylocs[jtask].size() / 4;
     std::vector<double> lats(nobs);
     std::vector<double> lons(nobs);
     obs_times_by_task_[jtask].resize(nobs);
     size_t ii = 0;
     for (size_t jobs = 0; jobs < nobs; ++jobs) {
-      lats[jobs] = mylocs_by_task[jtask][ii];
-      lons[jobs] = mylocs_by_task[jtask][ii + 1];
+      lats[jobs] = mylocs[jtask][ii];
+      lons[jobs] = mylocs[jtask][ii + 1];
       ii += 2;
-      obs_times_by_task_[jtask][jobs].deserialize(mylocs_by_task[jtask], ii);
+      obs_times_by_task_[jtask][jobs].deserialize(mylocs[jtask], ii);
     }
-    ASSERT(mylocs_by_task[jtask].size() == ii);
+    ASSERT(mylocs[jtask].size() == ii);
     interp_[jtask] = std::make_unique<LocalInterp_>(interpConf_, geom, lats, lons);
   }
+  myobs_locs_by_task_.clear();
+}
 
-  Log::trace() << "GetValues::GetValues done" << std::endl;
+// -----------------------------------------------------------------------------
+
+template <typename MODEL, typename OBS>
+void GetValues<MODEL, OBS>::exchangeLocations(
+                            const Geometry_ & geom,
+                            const std::vector<std::shared_ptr<GetValues>> & getvals) {
+  Log::trace() << "GetValues::exchangeLocations start" << std::endl;
+  util::Timer timer("oops::GetValues", "exchangeLocations");
+  if (getvals.empty()) return;
+  const eckit::mpi::Comm & comm = getvals[0]->comm_;
+  const size_t ntasks = comm.size();
+  const size_t ngv = getvals.size();
+  const int tag = getvals[0]->tag_;
+
+// Sizes for all GetValues in a single allToAll (one block of ngv sizes per task)
+  std::vector<int> nsend(ntasks * ngv);
+  for (size_t jg = 0; jg < ngv; ++jg) {
+    ASSERT(getvals[jg]->myobs_locs_by_task_.size() == ntasks);
+    for (size_t jtask = 0; jtask < ntasks; ++jtask) {
+      nsend[jtask * ngv + jg] = getvals[jg]->myobs_locs_by_task_[jtask].size();
+    }
+  }
+  std::vector<int> nrecv(ntasks * ngv);
+  comm.allToAll(nsend, nrecv);
+
+// One message per task and direction holds the locations for all GetValues
+  std::vector<std::vector<double>> sendbuf(ntasks);
+  std::vector<std::vector<double>> recvbuf(ntasks);
+  std::vector<eckit::mpi::Request> reqs;
+  for (size_t jtask = 0; jtask < ntasks; ++jtask) {
+    size_t nn = 0;
+    for (size_t jg = 0; jg < ngv; ++jg) nn += nrecv[jtask * ngv + jg];
+    if (nn > 0) {
+      recvbuf[jtask].resize(nn);
+      reqs.push_back(comm.iReceive(recvbuf[jtask].data(), nn, jtask, tag));
+    }
+  }
+  for (size_t jtask = 0; jtask < ntasks; ++jtask) {
+    for (size_t jg = 0; jg < ngv; ++jg) {
+      const std::vector<double> & locs = getvals[jg]->myobs_locs_by_task_[jtask];
+      sendbuf[jtask].insert(sendbuf[jtask].end(), locs.begin(), locs.end());
+    }
+    if (!sendbuf[jtask].empty()) {
+      reqs.push_back(comm.iSend(sendbuf[jtask].data(), sendbuf[jtask].size(), jtask, tag));
+    }
+  }
+  for (eckit::mpi::Request & req : reqs) {
+    eckit::mpi::Status st = comm.wait(req);
+    ASSERT(st.error() == 0);
+  }
+
+// Split received locations between GetValues and set up interpolators
+  std::vector<size_t> offsets(ntasks, 0);
+  for (size_t jg = 0; jg < ngv; ++jg) {
+    std::vector<int> gsend(ntasks);
+    std::vector<int> grecv(ntasks);
+    for (size_t jtask = 0; jtask < ntasks; ++jtask) {
+      gsend[jtask] = nsend[jtask * ngv + jg];
+      grecv[jtask] = nrecv[jtask * ngv + jg];
+    }
+    getvals[jg]->setTasks(gsend, grecv);
+    std::vector<std::vector<double>> mylocs;
+    for (const size_t jtask : getvals[jg]->interpTasks_) {
+      const auto first = recvbuf[jtask].begin() + offsets[jtask];
+      mylocs.emplace_back(first, first + grecv[jtask]);
+      offsets[jtask] += grecv[jtask];
+    }
+    getvals[jg]->setInterpolators(geom, mylocs);
+  }
+
+  Log::trace() << "GetValues::exchangeLocations done" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename MODEL, typename OBS>
+void GetValues<MODEL, OBS>::exchangeValues(
+                            const std::vector<std::shared_ptr<GetValues>> & getvals) {
+  Log::trace() << "GetValues::exchangeValues start" << std::endl;
+  util::Timer timer("oops::GetValues", "exchangeValues");
+  if (getvals.empty()) return;
+  const eckit::mpi::Comm & comm = getvals[0]->comm_;
+  const size_t ntasks = comm.size();
+  const int tag = getvals[0]->tag_;
+
+// Receive interpolated values for all GetValues in one message per task
+  std::vector<size_t> nrecv(ntasks, 0);
+  for (const std::shared_ptr<GetValues> & gv : getvals) {
+    for (size_t jj = 0; jj < gv->obsTasks_.size(); ++jj) {
+      nrecv[gv->obsTasks_[jj]] += gv->myobs_index_by_task_[jj].size() * gv->varsizes_;
+    }
+  }
+  std::vector<std::vector<double>> recvbuf(ntasks);
+  std::vector<eckit::mpi::Request> reqs;
+  for (size_t jtask = 0; jtask < ntasks; ++jtask) {
+    if (nrecv[jtask] > 0) {
+      recvbuf[jtask].resize(nrecv[jtask]);
+      reqs.push_back(comm.iReceive(recvbuf[jtask].data(), nrecv[jtask], jtask, tag));
+    }
+  }
+
+// Send values interpolated locally, in the same order
+  std::vector<std::vector<double>> sendbuf(ntasks);
+  for (const std::shared_ptr<GetValues> & gv : getvals) {
+    ASSERT(gv->locinterp_.size() == gv->interpTasks_.size());
+    for (size_t jj = 0; jj < gv->interpTasks_.size(); ++jj) {
+      std::vector<double> & buf = sendbuf[gv->interpTasks_[jj]];
+      buf.insert(buf.end(), gv->locinterp_[jj].begin(), gv->locinterp_[jj].end());
+    }
+  }
+  for (size_t jtask = 0; jtask < ntasks; ++jtask) {
+    if (!sendbuf[jtask].empty()) {
+      reqs.push_back(comm.iSend(sendbuf[jtask].data(), sendbuf[jtask].size(), jtask, tag));
+    }
+  }
+  for (eckit::mpi::Request & req : reqs) {
+    eckit::mpi::Status st = comm.wait(req);
+    ASSERT(st.error() == 0);
+  }
+
+// Split received values between GetValues, ready for fillGeoVaLs
+  std::vector<size_t> offsets(ntasks, 0);
+  for (const std::shared_ptr<GetValues> & gv : getvals) {
+    ASSERT(gv->recvinterp_.empty());
+    for (size_t jj = 0; jj < gv->obsTasks_.size(); ++jj) {
+      const size_t jtask = gv->obsTasks_[jj];
+      const size_t nn = gv->myobs_index_by_task_[jj].size() * gv->varsizes_;
+      const auto first = recvbuf[jtask].begin() + offsets[jtask];
+      gv->recvinterp_.emplace_back(first, first + nn);
+      offsets[jtask] += nn;
+    }
+  }
+
+  Log::trace() << "GetValues::exchangeValues done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
@@ -241,9 +451,10 @@ void GetValues<MODEL, OBS>::initialize(const util::Duration & tstep) {
   Log::trace() << "GetValues::initialize start" << std::endl;
   const double missing = util::missingValue(double());
   ASSERT(locinterp_.empty());
+  ASSERT(myobs_locs_by_task_.empty());  // locations have been exchanged
 
-  locinterp_.resize(ntasks_);
-  for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
+  locinterp_.resize(interpTasks_.size());
+  for (size_t jtask = 0; jtask < interpTasks_.size(); ++jtask) {
     locinterp_[jtask].resize(obs_times_by_task_[jtask].size() * varsizes_, missing);
   }
   hslot_ = doLinearTimeInterpolation_ ? tstep : tstep/2;
@@ -311,7 +522,7 @@ void GetValues<MODEL, OBS>::process(const State_ & xx) {
   util::DateTime t1 = std::max(xx.validTime()-hslot_, winbgn_);
   util::DateTime t2 = std::min(xx.validTime()+hslot_, winend_);
 
-  for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
+  for (size_t jtask = 0; jtask < interpTasks_.size(); ++jtask) {
 //  Mask obs outside time slot
     std::vector<bool> mask(obs_times_by_task_[jtask].size());
     for (size_t jobs = 0; jobs < obs_times_by_task_[jtask].size(); ++jobs) {
@@ -339,19 +550,20 @@ void GetValues<MODEL, OBS>::finalize() {
   util::Timer timer("oops::GetValues", "finalize");
 
 // Send values interpolated locally (non-blocking)
-  send_req_.resize(ntasks_);
-  for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
-    send_req_[jtask] = comm_.iSend(&locinterp_[jtask][0], locinterp_[jtask].size(), jtask, tag_);
+  send_req_.resize(interpTasks_.size());
+  for (size_t jtask = 0; jtask < interpTasks_.size(); ++jtask) {
+    send_req_[jtask] = comm_.iSend(locinterp_[jtask].data(), locinterp_[jtask].size(),
+                                   interpTasks_[jtask], tag_);
   }
 
 // Allocate receive buffers and non blocking receive of interpolated values
   ASSERT(recvinterp_.empty());
-  recvinterp_.resize(ntasks_);
-  recv_req_.resize(ntasks_);
-  for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
+  recvinterp_.resize(obsTasks_.size());
+  recv_req_.resize(obsTasks_.size());
+  for (size_t jtask = 0; jtask < obsTasks_.size(); ++jtask) {
     const size_t nrecv = myobs_index_by_task_[jtask].size() * varsizes_;
     recvinterp_[jtask].resize(nrecv);
-    recv_req_[jtask] = comm_.iReceive(&recvinterp_[jtask][0], nrecv, jtask, tag_);
+    recv_req_[jtask] = comm_.iReceive(recvinterp_[jtask].data(), nrecv, obsTasks_[jtask], tag_);
   }
 
   Log::trace() << "GetValues::finalize done" << std::endl;
@@ -364,20 +576,27 @@ void GetValues<MODEL, OBS>::fillGeoVaLs(GeoVaLs_ & geovals) {
   Log::trace() << "GetValues::fillGeoVaLs start" << std::endl;
   util::Timer timer("oops::GetValues", "fillGeoVaLs");
 
-// Wait for received interpolated values and store in GeoVaLs
-  ASSERT(recvinterp_.size() == ntasks_);
-  for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
+// Wait for received interpolated values and store in GeoVaLs as they arrive
+// (nothing to wait for if values were received by exchangeValues)
+  ASSERT(recvinterp_.size() == obsTasks_.size());
+  if (recv_req_.empty()) {
+    for (size_t jtask = 0; jtask < obsTasks_.size(); ++jtask) {
+      geovals.fill(myobs_index_by_task_[jtask], recvinterp_[jtask], this->levelsTopDown_);
+    }
+  }
+  ASSERT(recv_req_.empty() || recv_req_.size() == obsTasks_.size());
+  for (size_t jtask = 0; jtask < recv_req_.size(); ++jtask) {
     int itask = -1;
     eckit::mpi::Status rst = comm_.waitAny(recv_req_, itask);
     ASSERT(rst.error() == 0);
-    ASSERT(itask >=0 && (size_t)itask < ntasks_);
+    ASSERT(itask >=0 && (size_t)itask < obsTasks_.size());
     geovals.fill(myobs_index_by_task_[itask], recvinterp_[itask], this->levelsTopDown_);
   }
   recv_req_.clear();
   recvinterp_.clear();
 
 // Clean-up send buffers (after making sure data has been sent)
-  for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
+  for (size_t jtask = 0; jtask < send_req_.size(); ++jtask) {
     int itask = -1;
     eckit::mpi::Status sst = comm_.waitAny(send_req_, itask);
     ASSERT(sst.error() == 0);
@@ -397,8 +616,9 @@ void GetValues<MODEL, OBS>::initializeTL(const util::Duration & tstep) {
   Log::trace() << "GetValues::initializeTL start" << std::endl;
   const double missing = util::missingValue(double());
   ASSERT(locinterp_.empty());
-  locinterp_.resize(ntasks_);
-  for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
+  ASSERT(myobs_locs_by_task_.empty());  // locations have been exchanged
+  locinterp_.resize(interpTasks_.size());
+  for (size_t jtask = 0; jtask < interpTasks_.size(); ++jtask) {
     locinterp_[jtask].resize(obs_times_by_task_[jtask].size() * linsizes_, missing);
   }
   hslot_ = tstep/2;
@@ -415,7 +635,7 @@ void GetValues<MODEL, OBS>::processTL(const Increment_ & dx) {
   util::DateTime t1 = std::max(dx.validTime()-hslot_, winbgn_);
   util::DateTime t2 = std::min(dx.validTime()+hslot_, winend_);
 
-  for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
+  for (size_t jtask = 0; jtask < interpTasks_.size(); ++jtask) {
 //  Mask obs outside time slot
     std::vector<bool> mask(obs_times_by_task_[jtask].size());
     for (size_t jobs = 0; jobs < obs_times_by_task_[jtask].size(); ++jobs) {
@@ -437,19 +657,20 @@ void GetValues<MODEL, OBS>::finalizeTL() {
   util::Timer timer("oops::GetValues", "finalizeTL");
 
 // Send values interpolated locally (non-blocking)
-  send_req_.resize(ntasks_);
-  for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
-    send_req_[jtask] = comm_.iSend(&locinterp_[jtask][0], locinterp_[jtask].size(), jtask, tag_);
+  send_req_.resize(interpTasks_.size());
+  for (size_t jtask = 0; jtask < interpTasks_.size(); ++jtask) {
+    send_req_[jtask] = comm_.iSend(locinterp_[jtask].data(), locinterp_[jtask].size(),
+                                   interpTasks_[jtask], tag_);
   }
 
 // Allocate receive buffers and non blocking receive of interpolated values
   ASSERT(recvinterp_.empty());
-  recvinterp_.resize(ntasks_);
-  recv_req_.resize(ntasks_);
-  for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
+  recvinterp_.resize(obsTasks_.size());
+  recv_req_.resize(obsTasks_.size());
+  for (size_t jtask = 0; jtask < obsTasks_.size(); ++jtask) {
     const size_t nrecv = myobs_index_by_task_[jtask].size() * linsizes_;
     recvinterp_[jtask].resize(nrecv);
-    recv_req_[jtask] = comm_.iReceive(&recvinterp_[jtask][0], nrecv, jtask, tag_);
+    recv_req_[jtask] = comm_.iReceive(recvinterp_[jtask].data(), nrecv, obsTasks_[jtask], tag_);
   }
 
   Log::trace() << "GetValues::finalizeTL done" << std::endl;
@@ -462,20 +683,20 @@ void GetValues<MODEL, OBS>::fillGeoVaLsTL(GeoVaLs_ & geovals) {
   Log::trace() << "GetValues::fillGeoVaLsTL start" << std::endl;
   util::Timer timer("oops::GetValues", "fillGeoVaLsTL");
 
-// Wait for received interpolated values and store in GeoVaLs
-  ASSERT(recvinterp_.size() == ntasks_);
-  for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
+// Wait for received interpolated values and store in GeoVaLs as they arrive
+  ASSERT(recv_req_.size() == obsTasks_.size());
+  for (size_t jtask = 0; jtask < obsTasks_.size(); ++jtask) {
     int itask = -1;
     eckit::mpi::Status rst = comm_.waitAny(recv_req_, itask);
     ASSERT(rst.error() == 0);
-    ASSERT(itask >=0 && (size_t)itask < ntasks_);
+    ASSERT(itask >=0 && (size_t)itask < obsTasks_.size());
     geovals.fill(myobs_index_by_task_[itask], recvinterp_[itask], this->levelsTopDown_);
   }
   recv_req_.clear();
   recvinterp_.clear();
 
 // Clean-up send buffers (after making sure data has been sent)
-  for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
+  for (size_t jtask = 0; jtask < send_req_.size(); ++jtask) {
     int itask = -1;
     eckit::mpi::Status sst = comm_.waitAny(send_req_, itask);
     ASSERT(sst.error() == 0);
@@ -507,7 +728,7 @@ void GetValues<MODEL, OBS>::processAD(Increment_ & dx) {
   util::DateTime t1 = std::max(dx.validTime()-hslot_, winbgn_);
   util::DateTime t2 = std::min(dx.validTime()+hslot_, winend_);
 
-  for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
+  for (size_t jtask = 0; jtask < interpTasks_.size(); ++jtask) {
 //  Mask obs outside time slot
     std::vector<bool> mask(obs_times_by_task_[jtask].size());
     for (size_t jobs = 0; jobs < obs_times_by_task_[jtask].size(); ++jobs) {
@@ -532,19 +753,19 @@ void GetValues<MODEL, OBS>::finalizeAD(const util::Duration & tstep) {
 
 // (Adjoint of) Send values interpolated locally (non-blocking)
 // i.e. wait for receive of local sensitivities
-  ASSERT(locinterp_.size() == ntasks_);
-  for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
+  ASSERT(locinterp_.size() == interpTasks_.size());
+  for (size_t jtask = 0; jtask < send_req_.size(); ++jtask) {
     int itask = -1;
     eckit::mpi::Status sst = comm_.waitAny(send_req_, itask);
     ASSERT(sst.error() == 0);
-    ASSERT(itask >=0 && (size_t)itask < ntasks_);
+    ASSERT(itask >=0 && (size_t)itask < interpTasks_.size());
   }
   send_req_.clear();
 
 // (Adjoint of) Allocate receive buffers and non blocking receive of interpolated values
 // i.e. deallocate buffers (after making sure data has been sent)
-  ASSERT(recvinterp_.size() == ntasks_);
-  for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
+  ASSERT(recv_req_.size() == obsTasks_.size());
+  for (size_t jtask = 0; jtask < obsTasks_.size(); ++jtask) {
     int itask = -1;
     eckit::mpi::Status rst = comm_.waitAny(recv_req_, itask);
     ASSERT(rst.error() == 0);
@@ -567,23 +788,24 @@ void GetValues<MODEL, OBS>::fillGeoVaLsAD(const GeoVaLs_ & geovals) {
 // (Afjoint of) Clean-up send buffers
 // i.e. allocate buffer and prepare to receive values
   ASSERT(locinterp_.empty());
-  locinterp_.resize(ntasks_);
-  send_req_.resize(ntasks_);
-  for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
+  locinterp_.resize(interpTasks_.size());
+  send_req_.resize(interpTasks_.size());
+  for (size_t jtask = 0; jtask < interpTasks_.size(); ++jtask) {
     locinterp_[jtask].resize(obs_times_by_task_[jtask].size() * linsizes_, missing);
-    send_req_[jtask] = comm_.iReceive(&locinterp_[jtask][0], locinterp_[jtask].size(), jtask, tag_);
+    send_req_[jtask] = comm_.iReceive(locinterp_[jtask].data(), locinterp_[jtask].size(),
+                                      interpTasks_[jtask], tag_);
   }
 
 // (Adjoint of) Wait for received interpolated values and store in GeoVaLs
 // i.e. get values from GeoVaLs and send them
   ASSERT(recvinterp_.empty());
-  recvinterp_.resize(ntasks_);
-  recv_req_.resize(ntasks_);
-  for (size_t jtask = 0; jtask < ntasks_; ++jtask) {
+  recvinterp_.resize(obsTasks_.size());
+  recv_req_.resize(obsTasks_.size());
+  for (size_t jtask = 0; jtask < obsTasks_.size(); ++jtask) {
     const size_t nrecv = myobs_index_by_task_[jtask].size() * linsizes_;
     recvinterp_[jtask].resize(nrecv);
     geovals.fillAD(myobs_index_by_task_[jtask], recvinterp_[jtask], this->levelsTopDown_);
-    recv_req_[jtask] = comm_.iSend(&recvinterp_[jtask][0], nrecv, jtask, tag_);
+    recv_req_[jtask] = comm_.iSend(recvinterp_[jtask].data(), nrecv, obsTasks_[jtask], tag_);
   }
 
   Log::trace() << "GetValues::fillGeoVaLsAD" << std::endl;
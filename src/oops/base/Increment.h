@@ -25,6 +25,7 @@
 #include "oops/mpi/mpi.h"
 #include "oops/util/DateTime.h"
 #include "oops/util/gatherPrint.h"
+#include "oops/util/Logger.h"
 #include "oops/util/Timer.h"
 
 namespace oops {
@@ -149,7 +150,7 @@ double Increment<MODEL>::norm() const {
 
 template<typename MODEL>
 void Increment<MODEL>::shift_forward(const util::DateTime & begin) {
-  Log::trace() << "Increment<MODEL>::Increment shift_forward starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::Increment shift_forward starting" << std::endl;
   static int tag = 159357;
   size_t mytime = timeComm_->rank();
 
@@ -166,14 +167,14 @@ void Increment<MODEL>::shift_forward(const util::DateTime & begin) {
   }
 
   ++tag;
-  Log::trace() << "Increment<MODEL>::Increment shift_forward done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::Increment shift_forward done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
 void Increment<MODEL>::shift_backward(const util::DateTime & end) {
-  Log::trace() << "Increment<MODEL>::Increment shift_backward starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::Increment shift_backward starting" << std::endl;
   static int tag = 30951;
   size_t mytime = timeComm_->rank();
 
@@ -190,7 +191,7 @@ void Increment<MODEL>::shift_backward(const util::DateTime & end) {
   }
 
   ++tag;
-  Log::trace() << "Increment<MODEL>::Increment shift_backward done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::Increment shift_backward done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
@@ -259,10 +260,10 @@ void Increment<MODEL>::print(std::ostream & os) const {
 /// Add on \p dx incrment to model state \p xx
 template <typename MODEL>
 State<MODEL> & operator+=(State<MODEL> & xx, const Increment<MODEL> & dx) {
-  Log::trace() << "operator+=(State, Increment) starting" << std::endl;
+  OOPS_LOG_TRACE << "operator+=(State, Increment) starting" << std::endl;
   util::Timer timer("oops::Increment", "operator+=(State, Increment)");
   xx.state() += dx.increment();
-  Log::trace() << "operator+=(State, Increment) done" << std::endl;
+  OOPS_LOG_TRACE << "operator+=(State, Increment) done" << std::endl;
   return xx;
 }
 
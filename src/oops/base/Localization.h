@@ -14,6 +14,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <boost/noncopyable.hpp>
 
@@ -63,6 +64,11 @@ class Localization : public util::Printable,
   /// Apply 4D localization. All 3D blocks of the 4D localization matrix are the same
   /// (and defined by 3D localization loc_)
   virtual void multiply(Increment_ & dx) const;
+  /// Apply 4D localization to all increments in \p dxs (e.g. ensemble members), letting
+  /// the 3D localization process all of them in one call
+  virtual void multiplyEnsemble(std::vector<Increment_> & dxs) const;
+  /// True if the 3D localization processes several members together in multiplyEnsemble
+  bool hasBatchedMultiply() const {return loc_->hasBatchedMultiply();}
 
  private:
   /// Print, used in logging
@@ -179,6 +185,53 @@ void Localization<MODEL>::multiply(Increment_ & dx) const {
 
 // -----------------------------------------------------------------------------
 
+template <typename MODEL>
+void Localization<MODEL>::multiplyEnsemble(std::vector<Increment_> & dxs) const {
+  Log::trace() << "Localization<MODEL>::multiplyEnsemble starting" << std::endl;
+  util::Timer timer(classname(), "multiplyEnsemble");
+  if (dxs.empty()) return;
+  const eckit::mpi::Comm & comm = dxs[0].timeComm();
+  static int tag = 34567;
+  size_t nslots = comm.size();
+  int mytime = comm.rank();
+
+  // Same as multiply (see comment there) for each member, messages between a given pair
+  // of tasks are received in the order they are sent.
+  if (mytime > 0) {
+    for (Increment_ & dx : dxs) oops::mpi::send(comm, dx, 0, tag);
+    for (Increment_ & dx : dxs) {
+      util::DateTime dt = dx.validTime();   // Save original time value
+      dx.zero();
+      oops::mpi::receive(comm, dx, 0, tag);
+      dx.updateTime(dt - dx.validTime());  // Set time back to original value
+    }
+  } else {
+    // Sum over timeslots
+    if (nslots > 1) {
+      Increment_ dxtmp(dxs[0]);
+      for (size_t jj = 1; jj < nslots; ++jj) {
+        for (Increment_ & dx : dxs) {
+          oops::mpi::receive(comm, dxtmp, jj, tag);
+          dx.axpy(1.0, dxtmp, false);
+        }
+      }
+    }
+
+    // Apply 3D localization to all members
+    loc_->multiplyEnsemble(dxs);
+
+    // Copy result to all timeslots
+    for (size_t jj = 1; jj < nslots; ++jj) {
+      for (const Increment_ & dx : dxs) oops::mpi::send(comm, dx, jj, tag);
+    }
+  }
+  ++tag;
+
+  Log::trace() << "Localization<MODEL>::multiplyEnsemble done" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
 template <typename MODEL>
 void Localization<MODEL>::print(std::ostream & os) const {
   Log::trace() << "Localization<MODEL>::print starting" << std::endl;
@@ -12,6 +12,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <boost/noncopyable.hpp>
 
@@ -61,6 +62,13 @@ class Model : public util::Printable,
   /// Does not need to be implemented in the models
   void forecast(State_ & xx, const ModelAux_ &,
                 const util::Duration & len, PostProcessor<State_> & post) const;
+  /// \brief Run the forecasts of all members of ensemble \p xx (valid at the same time)
+  /// together for \p len time, with \p post postprocessors for each member
+  void forecastEnsemble(std::vector<State_ *> & xx, const ModelAux_ &,
+                        const util::Duration & len,
+                        std::vector<PostProcessor<State_>> & post) const;
+  /// \brief Whether the model steps ensemble members more efficiently together than in turn
+  bool hasBatchedStep() const {return model_->hasBatchedStep();}
 
   /// \brief Time step for running Model's forecast in oops (frequency with which the
   /// State will be updated)
@@ -148,6 +156,41 @@ void Model<MODEL>::forecast(State_ & xx, const ModelAux_ & maux,
 
 // -----------------------------------------------------------------------------
 
+template<typename MODEL>
+void Model<MODEL>::forecastEnsemble(std::vector<State_ *> & xx, const ModelAux_ & maux,
+                                    const util::Duration & len,
+                                    std::vector<PostProcessor<State_>> & post) const {
+  Log::trace() << "Model<MODEL>::forecastEnsemble starting" << std::endl;
+  ASSERT(xx.size() > 0);
+  ASSERT(post.size() == xx.size());
+
+  const util::DateTime end(xx[0]->validTime() + len);
+  for (size_t jm = 0; jm < xx.size(); ++jm) {
+    ASSERT(xx[jm]->validTime() == xx[0]->validTime());
+    Log::info() << "Model:forecastEnsemble: member " << jm << " starting: " << *xx[jm]
+                << std::endl;
+    this->initialize(*xx[jm]);
+    post[jm].initialize(*xx[jm], end, model_->timeResolution());
+    post[jm].process(*xx[jm]);
+  }
+  while (xx[0]->validTime() < end) {
+    util::Timer timer(classname(), "stepEnsemble");
+    model_->stepEnsemble(xx, maux);
+    for (size_t jm = 0; jm < xx.size(); ++jm) post[jm].process(*xx[jm]);
+  }
+  for (size_t jm = 0; jm < xx.size(); ++jm) {
+    post[jm].finalize(*xx[jm]);
+    this->finalize(*xx[jm]);
+    Log::info() << "Model:forecastEnsemble: member " << jm << " finished: " << *xx[jm]
+                << std::endl;
+    ASSERT(xx[jm]->validTime() == end);
+  }
+
+  Log::trace() << "Model<MODEL>::forecastEnsemble done" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+
 template<typename MODEL>
 void Model<MODEL>::initialize(State_ & xx) const {
   Log::trace() << "Model<MODEL>::initialize starting" << std::endl;
@@ -83,9 +83,11 @@ class Observer {
   Observer(const ObsSpace_ &, const Parameters_ &);
 
 /// \brief Initializes variables, obs bias, obs filters (could be different for
-/// different iterations
+/// different iterations. With \p deferExchange, the locations still have to be exchanged by
+/// the caller (see GetValues::exchangeLocations).
   std::shared_ptr<GetValues_> initialize(const Geometry_ &, const ObsAuxCtrl_ &,
-                                         ObsError_ &, const eckit::Configuration &);
+                                         ObsError_ &, const eckit::Configuration &,
+                                         const bool deferExchange = false);
 
 /// \brief Computes H(x) from the filled in GeoVaLs
   void finalize(ObsVector_ &);
@@ -127,7 +129,8 @@ Observer<MODEL, OBS>::Observer(const ObsSpace_ & obspace, const Parameters_ & pa
 template <typename MODEL, typename OBS>
 std::shared_ptr<GetValues<MODEL, OBS>>
 Observer<MODEL, OBS>::initialize(const Geometry_ & geom, const ObsAuxCtrl_ & biascoeff,
-                                 ObsError_ & R, const eckit::Configuration & conf) {
+                                 ObsError_ & R, const eckit::Configuration & conf,
+                                 const bool deferExchange) {
   Log::trace() << "Observer<MODEL, OBS>::initialize start" << std::endl;
 // Save information for finalize
   iterconf_.reset(new eckit::LocalConfiguration(conf));
@@ -150,7 +153,8 @@ Observer<MODEL, OBS>::initialize(const Geometry_ & geom, const ObsAuxCtrl_ & bia
 // Set up GetValues
   locations_.reset(new Locations_(obsop_->locations()));
   getvals_.reset(new GetValues_(parameters_.getValues, geom, obspace_.windowStart(),
-                                obspace_.windowEnd(), *locations_, geovars_));
+                                obspace_.windowEnd(), *locations_, geovars_, Variables(),
+                                deferExchange));
 
   initialized_ = true;
   Log::trace() << "Observer<MODEL, OBS>::initialize done" << std::endl;
@@ -124,10 +124,12 @@ void Observers<MODEL, OBS>::initialize(const Geometry_ & geom, const ObsAuxCtrls
                                        const eckit::Configuration & conf) {
   Log::trace() << "Observers<MODEL, OBS>::initialize start" << std::endl;
 
+  const bool combine = getValuesParams_.combineCommunications;
   std::shared_ptr<GetValuePosts_> getvals(new GetValuePosts_(getValuesParams_));
   for (size_t jj = 0; jj < observers_.size(); ++jj) {
-    getvals->append(observers_[jj]->initialize(geom, obsaux[jj], Rmat[jj], conf));
+    getvals->append(observers_[jj]->initialize(geom, obsaux[jj], Rmat[jj], conf, combine));
   }
+  if (combine) getvals->exchangeLocations(geom);
   pp.enrollProcessor(getvals);
 
   Log::trace() << "Observers<MODEL, OBS>::initialize done" << std::endl;
@@ -59,6 +59,9 @@ template <typename FLDS> class PostBase : private boost::noncopyable {
     this->doFinalize(xx);
   }
 
+/// Next time at which processing will happen (false if none left)
+  bool nextEvent(util::DateTime & next) const {return timer_.nextEvent(next);}
+
  private:
   PostTimer timer_;
 
@@ -16,6 +16,8 @@
 #include <memory>
 
 #include "oops/base/PostBase.h"
+#include "oops/util/DateTime.h"
+#include "oops/util/Duration.h"
 
 namespace oops {
 
@@ -24,6 +26,9 @@ namespace oops {
  *  This class controls model post processing in the most general sense,
  *  ie all diagnostics computations that do not affect the model integration.
  *  It just calls all the individual processors one by one.
+ *  Processors are only called at steps where at least one of them has an event
+ *  scheduled: the earliest next event of all processors is cached after each
+ *  step, and (forward in time) steps before it are skipped entirely.
  */
 
 template<typename FLDS>
@@ -31,19 +36,24 @@ class PostProcessor {
   typedef PostBase<FLDS> PostBase_;
 
  public:
-  PostProcessor() {}
-  PostProcessor(const PostProcessor & pp): processors_(pp.processors_) {}
+  PostProcessor(): processors_(), last_(), next_(), hasNext_(false), scheduled_(false) {}
+  PostProcessor(const PostProcessor & pp): processors_(pp.processors_), last_(), next_(),
+    hasNext_(false), scheduled_(false) {}
   ~PostProcessor() {}
 
   void enrollProcessor(PostBase_ * pp) {
     if (pp != 0) {
       std::shared_ptr<PostBase_> sp(pp);
       processors_.push_back(sp);
+      scheduled_ = false;
     }
   }
 
   void enrollProcessor(std::shared_ptr<PostBase_> pp) {
-    if (pp != 0) processors_.push_back(pp);
+    if (pp != 0) {
+      processors_.push_back(pp);
+      scheduled_ = false;
+    }
   }
 
   void initialize(const FLDS & xx, const util::DateTime & end,
@@ -51,12 +61,16 @@ class PostProcessor {
     for (auto & jp : processors_) {
       jp->initialize(xx, end, step);
     }
+    this->schedule(xx.validTime());
   }
 
   void process(const FLDS & xx) {
+    const util::DateTime & now = xx.validTime();
+    if (scheduled_ && now > last_ && (!hasNext_ || now < next_)) return;
     for (auto & jp : processors_) {
       jp->process(xx);
     }
+    this->schedule(now);
   }
 
   void finalize(const FLDS & xx) {
@@ -66,7 +80,25 @@ class PostProcessor {
   }
 
  private:
+/// Cache earliest next event of all processors after time now
+  void schedule(const util::DateTime & now) {
+    last_ = now;
+    hasNext_ = false;
+    util::DateTime tt;
+    for (const auto & jp : processors_) {
+      if (jp->nextEvent(tt) && (!hasNext_ || tt < next_)) {
+        next_ = tt;
+        hasNext_ = true;
+      }
+    }
+    scheduled_ = true;
+  }
+
   std::vector< std::shared_ptr<PostBase_> > processors_;
+  util::DateTime last_;
+  util::DateTime next_;
+  bool hasNext_;
+  bool scheduled_;
   PostProcessor operator= (const PostProcessor &);
 };
 
@@ -24,16 +24,18 @@
 namespace oops {
 // -----------------------------------------------------------------------------
 PostTimer::PostTimer()
-  : options_(), bgn_(), end_(), start_(), finish_() {}
+  : options_(), bgn_(), end_(), start_(), finish_(), pptimes_(), next_(0), everyStep_(true) {}
 // -----------------------------------------------------------------------------
 PostTimer::PostTimer(const PostTimerParameters & parameters)
-  : options_(parameters), bgn_(), end_(), start_(), finish_() {
+  : options_(parameters), bgn_(), end_(), start_(), finish_(), pptimes_(), next_(0),
+    everyStep_(true) {
 }
 // -----------------------------------------------------------------------------
 PostTimer::PostTimer(const util::DateTime & start, const util::DateTime & finish,
                      const util::Duration & freq)
   : options_(), bgn_(), end_(),
-    start_(new util::DateTime(start)), finish_(new util::DateTime(finish)) {
+    start_(new util::DateTime(start)), finish_(new util::DateTime(finish)),
+    pptimes_(), next_(0), everyStep_(true) {
   // setup config with passed frequency to init the options
   eckit::LocalConfiguration conf;
   conf.set("frequency", freq.toString());
@@ -55,31 +57,52 @@ void PostTimer::initialize(const util::DateTime & bgn, const util::DateTime & en
   end_ = finish;
   // increase bgn_ value if needed
   bgn_ += options_.first;
-}
-// -----------------------------------------------------------------------------
-bool PostTimer::itIsTime(const util::DateTime & now) {
-  bool doit = false;
 
+  // compile the schedule of output times within [bgn_, end_]
   const util::Duration & freq = options_.frequency;
   const std::vector<util::DateTime> & steps = options_.steps;
-
-  if (now >= bgn_ && now <= end_) {
-    // use at every step, and no prespecified steps?
-    doit = (freq.toSeconds() == 0 && steps.empty());
-    // frequency specified?
-    if (!doit && freq.toSeconds() > 0) {
-      const util::Duration dt = now - bgn_;
-      doit = (dt >= util::Duration(0) && dt % freq == 0);
+  everyStep_ = (freq.toSeconds() == 0 && steps.empty());
+  pptimes_.clear();
+  next_ = 0;
+  if (!everyStep_) {
+    if (freq.toSeconds() > 0) {
+      for (util::DateTime tt(bgn_); tt <= end_; tt += freq) pptimes_.push_back(tt);
     }
-    // steps are prespecified?
-    if (!doit && !steps.empty()) {
-      auto it = find(steps.begin(), steps.end(), now);
-      doit = (it != steps.end());
+    for (const util::DateTime & tt : steps) {
+      if (tt >= bgn_ && tt <= end_) pptimes_.push_back(tt);
     }
+    std::sort(pptimes_.begin(), pptimes_.end());
+    pptimes_.erase(std::unique(pptimes_.begin(), pptimes_.end()), pptimes_.end());
+  }
+  Log::trace() << "PostTimer::initialize " << pptimes_.size() << " scheduled times" << std::endl;
+}
+// -----------------------------------------------------------------------------
+bool PostTimer::itIsTime(const util::DateTime & now) {
+  bool doit = false;
+
+  if (everyStep_) {
+    doit = (now >= bgn_ && now <= end_);
+  } else {
+    // move cursor so that pptimes_[next_-1] <= now < pptimes_[next_]
+    while (next_ < pptimes_.size() && pptimes_[next_] <= now) ++next_;
+    while (next_ > 0 && pptimes_[next_ - 1] > now) --next_;
+    doit = (next_ > 0 && pptimes_[next_ - 1] == now);
   }
 
   Log::trace() << "In PostTimer:itIsTime, time = " << now << ", doit = " << doit << std::endl;
   return doit;
 }
 // -----------------------------------------------------------------------------
+bool PostTimer::nextEvent(util::DateTime & next) const {
+  if (everyStep_) {
+    next = bgn_;
+    return true;
+  }
+  if (next_ < pptimes_.size()) {
+    next = pptimes_[next_];
+    return true;
+  }
+  return false;
+}
+// -----------------------------------------------------------------------------
 }  // namespace oops
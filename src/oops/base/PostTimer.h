@@ -30,6 +30,10 @@ namespace oops {
 /// Handles timing of post-processing and similar actions
 /*!
  *  By default processing is performed on every call.
+ *  When a frequency and/or a list of steps is specified, all the output times
+ *  within the window are compiled into a sorted schedule on initialization and
+ *  a cursor into that schedule is moved along as time advances (forward or
+ *  backward), so that checking a time costs O(1) for monotonic sequences.
  */
 
 class PostTimer : private boost::noncopyable {
@@ -40,6 +44,9 @@ class PostTimer : private boost::noncopyable {
 
   void initialize(const util::DateTime &, const util::DateTime &);
   bool itIsTime(const util::DateTime &);
+/// Earliest scheduled time strictly after the last time checked (or any scheduled time if
+/// no time was checked since initialization). Returns false if no event is left.
+  bool nextEvent(util::DateTime &) const;
 
  private:
   PostTimerParameters options_;
@@ -47,7 +54,9 @@ class PostTimer : private boost::noncopyable {
   util::DateTime end_;
   std::unique_ptr<util::DateTime> start_;
   std::unique_ptr<util::DateTime> finish_;
-  std::vector<util::DateTime> pptimes_;
+  std::vector<util::DateTime> pptimes_;  // sorted schedule (unused if everyStep_)
+  size_t next_;                          // number of scheduled times <= last time checked
+  bool everyStep_;
 };
 
 // -----------------------------------------------------------------------------
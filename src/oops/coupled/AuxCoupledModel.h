@@ -159,6 +159,8 @@ double AuxCoupledModel<MODEL1, MODEL2>::norm() const {
     if (aux1_) zz = aux1_->norm();
     if (aux2_) zz = aux2_->norm();
     geom_->getCommPairRanks().allReduceInPlace(zz, eckit::mpi::Operation::SUM);
+    // Tasks without a partner in the other model get the sum from the first task
+    geom_->getCommModel().broadcast(zz, 0);
   } else {
     zz = aux1_->norm() + aux2_->norm();
   }
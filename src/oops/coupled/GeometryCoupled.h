@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -22,6 +24,7 @@
 
 #include "oops/base/Geometry.h"
 #include "oops/util/gatherPrint.h"
+#include "oops/util/parameters/OptionalParameter.h"
 #include "oops/util/parameters/Parameter.h"
 #include "oops/util/parameters/Parameters.h"
 #include "oops/util/parameters/RequiredParameter.h"
@@ -46,6 +49,9 @@ class GeometryCoupledParameters : public Parameters {
   RequiredParametersTupleT geometries{RequiredParameterInit(MODELs::name().c_str(), this) ... };
   // Parameter to run the models sequentially or in parallel
   Parameter<bool> parallel{"parallel", false, this};
+  // Relative share of the MPI tasks given to each model when running in parallel
+  // (default: half of the tasks for each model)
+  OptionalParameter<std::vector<double>> taskProportions{"task proportions", this};
 };
 
 // -----------------------------------------------------------------------------
@@ -60,6 +66,10 @@ class GeometryCoupled : public util::Printable {
 
   /// Accessor to the MPI communicator between models
   const eckit::mpi::Comm & getCommPairRanks() const {ASSERT(commPrints_); return *commPrints_;}
+  /// Accessor to the MPI communicator of the model run on this task
+  const eckit::mpi::Comm & getCommModel() const {ASSERT(commModel_); return *commModel_;}
+  /// Accessor to the MPI communicator of the coupled geometry
+  const eckit::mpi::Comm & getComm() const {return *comm_;}
 
   /// Accessors to components of coupled geometry
   const Geometry<MODEL1> & geometry1() const {ASSERT(geom1_); return *geom1_;}
@@ -80,6 +90,8 @@ class GeometryCoupled : public util::Printable {
 
   std::shared_ptr<Geometry<MODEL1>> geom1_;
   std::shared_ptr<Geometry<MODEL2>> geom2_;
+  const eckit::mpi::Comm * comm_;
+  eckit::mpi::Comm * commModel_;
   eckit::mpi::Comm * commPrints_;
   bool parallel_;
   int mymodel_;
@@ -92,21 +104,31 @@ class GeometryCoupled : public util::Printable {
 template <typename MODEL1, typename MODEL2>
 GeometryCoupled<MODEL1, MODEL2>::GeometryCoupled(const Parameters_ & params,
                                                  const eckit::mpi::Comm & comm)
-  : geom1_(), geom2_(), commPrints_(nullptr), parallel_(params.parallel.value()), mymodel_(-1)
+  : geom1_(), geom2_(), comm_(&comm), commModel_(nullptr), commPrints_(nullptr),
+    parallel_(params.parallel.value()), mymodel_(-1)
 {
   if (params.parallel) {
     const int mytask = comm.rank();
     const int ntasks = comm.size();
-    const int tasks_per_model = ntasks / 2;
-    mymodel_ = mytask / tasks_per_model + 1;
+    ASSERT(ntasks >= 2);
+    double share1 = 0.5;
+    if (params.taskProportions.value() != boost::none) {
+      const std::vector<double> & props = *params.taskProportions.value();
+      ASSERT(props.size() == 2 && props[0] > 0.0 && props[1] > 0.0);
+      share1 = props[0] / (props[0] + props[1]);
+    }
+    int tasks_model1 = std::lround(share1 * ntasks);
+    tasks_model1 = std::min(std::max(tasks_model1, 1), ntasks - 1);
+    mymodel_ = (mytask < tasks_model1) ? 1 : 2;
 
     // This creates the communicators for each model, named comm_model_{model name}
-    // The first half of the MPI tasks will go to MODEL1, and the second half to MODEL2
+    // The first tasks_model1 MPI tasks will go to MODEL1, and the others to MODEL2
     std::string commNameStr;
     if (mymodel_ == 1) commNameStr = "comm_model_" + MODEL1::name();
     if (mymodel_ == 2) commNameStr = "comm_model_" + MODEL2::name();
     char const *commName = commNameStr.c_str();
     eckit::mpi::Comm & commModel = comm.split(mymodel_, commName);
+    commModel_ = &commModel;
 
     if (mymodel_ == 1) {
       geom1_ = std::make_shared<Geometry<MODEL1>>(std::get<0>(params.geometries), commModel);
@@ -115,9 +137,11 @@ GeometryCoupled<MODEL1, MODEL2>::GeometryCoupled(const Parameters_ & params,
       geom2_ = std::make_shared<Geometry<MODEL2>>(std::get<1>(params.geometries), commModel);
     }
 
-// This is creating Nprocs/2 new communicators, each of which pairs two processes:
+// This is creating new communicators, each of which pairs two processes:
 // the N'th process among those handling model1 with the N'th process among
-// those handling model2. This is used for handling prints.
+// those handling model2. This is used for handling prints. When the models
+// have different numbers of tasks, the extra tasks of the larger one are alone
+// in their communicator.
     const int myrank = commModel.rank();
 
     std::string commPrintStr = "comm_ranks_" + std::to_string(myrank);
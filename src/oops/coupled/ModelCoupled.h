@@ -8,6 +8,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -23,6 +24,7 @@
 #include "oops/interface/ModelBase.h"
 #include "oops/mpi/mpi.h"
 #include "oops/util/Duration.h"
+#include "oops/util/parameters/OptionalParameter.h"
 #include "oops/util/Printable.h"
 
 #include "oops/coupled/AuxCoupledModel.h"
@@ -42,12 +44,16 @@ class ModelCoupledParameters : public ModelParametersBase {
  public:
   RequiredParameter<Parameters1_> model1{MODEL1::name().c_str(), this};
   RequiredParameter<Parameters2_> model2{MODEL2::name().c_str(), this};
+  /// Interval at which the models are synchronised; each model runs as many of its own
+  /// time steps as fit in it (default: least common multiple of the models time steps)
+  OptionalParameter<util::Duration> couplingTimeStep{"coupling time step", this};
 };
 
 // -----------------------------------------------------------------------------
 /// Implementation of a two-model "coupled" model. The two models run
-/// sequentially and are not exchanging any information currently. The two models
-/// have to use the same time resolution.
+/// sequentially or in parallel and are not exchanging any information currently.
+/// Each model keeps its own time step; one step of the coupled model runs both
+/// models over a coupling time step, which must be a multiple of both time steps.
 template <typename MODEL1, typename MODEL2>
 class ModelCoupled : public interface::ModelBase<TraitCoupled<MODEL1, MODEL2>> {
   typedef AuxCoupledModel<MODEL1, MODEL2>         AuxCoupledModel_;
@@ -80,6 +86,8 @@ class ModelCoupled : public interface::ModelBase<TraitCoupled<MODEL1, MODEL2>> {
   std::unique_ptr<ModelBase<MODEL1>> model1_;
   std::unique_ptr<ModelBase<MODEL2>> model2_;
   bool parallel_;
+  int nsteps1_;
+  int nsteps2_;
 };
 
 // -----------------------------------------------------------------------------
@@ -88,28 +96,49 @@ template <typename MODEL1, typename MODEL2>
 ModelCoupled<MODEL1, MODEL2>::ModelCoupled(const GeometryCoupled_ & geom,
                                            const Parameters_ & params)
   : tstep_(), geom_(new GeometryCoupled_(geom)), model1_(), model2_(),
-    parallel_(geom.isParallel()) {
+    parallel_(geom.isParallel()), nsteps1_(0), nsteps2_(0) {
   Log::trace() << "ModelCoupled::ModelCoupled starting" << std::endl;
-  if (parallel_) {
-    if (geom.modelNumber() == 1) {
-      model1_.reset(ModelFactory<MODEL1>::create(geom.geometry1(),
-                    params.model1.value().modelParameters));
-      tstep_ = model1_->timeResolution();
-    }
-    if (geom.modelNumber() == 2) {
-      model2_.reset(ModelFactory<MODEL2>::create(geom.geometry2(),
-                    params.model2.value().modelParameters));
-      tstep_ = model2_->timeResolution();
-    }
-  } else {
+  if (!parallel_ || geom.modelNumber() == 1) {
     model1_.reset(ModelFactory<MODEL1>::create(geom.geometry1(),
-                        params.model1.value().modelParameters));
+                  params.model1.value().modelParameters));
+  }
+  if (!parallel_ || geom.modelNumber() == 2) {
     model2_.reset(ModelFactory<MODEL2>::create(geom.geometry2(),
-                        params.model2.value().modelParameters));
-    ASSERT(model1_->timeResolution() == model2_->timeResolution());
-    tstep_ = model1_->timeResolution();
+                  params.model2.value().modelParameters));
   }
 
+// Time steps of both models (in parallel, each task only creates one of them)
+  int64_t dt1 = model1_ ? model1_->timeResolution().toSeconds() : 0;
+  int64_t dt2 = model2_ ? model2_->timeResolution().toSeconds() : 0;
+  if (parallel_) {
+    geom.getComm().allReduceInPlace(dt1, eckit::mpi::Operation::MAX);
+    geom.getComm().allReduceInPlace(dt2, eckit::mpi::Operation::MAX);
+  }
+  ASSERT(dt1 > 0 && dt2 > 0);
+
+  if (params.couplingTimeStep.value() != boost::none) {
+    tstep_ = *params.couplingTimeStep.value();
+  } else {
+    int64_t gcd = dt1;
+    int64_t rem = dt2;
+    while (rem != 0) {
+      const int64_t tmp = gcd % rem;
+      gcd = rem;
+      rem = tmp;
+    }
+    tstep_ = util::Duration(dt1 / gcd * dt2);
+  }
+  const int64_t dtc = tstep_.toSeconds();
+  if (dtc % dt1 != 0 || dtc % dt2 != 0) {
+    throw eckit::BadParameter("ModelCoupled: coupling time step " + tstep_.toString() +
+                              " is not a multiple of both model time steps", Here());
+  }
+  nsteps1_ = dtc / dt1;
+  nsteps2_ = dtc / dt2;
+  Log::info() << "ModelCoupled: coupling time step " << tstep_ << ", " << nsteps1_
+              << " step(s) of " << MODEL1::name() << " and " << nsteps2_ << " step(s) of "
+              << MODEL2::name() << std::endl;
+
   Log::trace() << "ModelCoupled::ModelCoupled done" << std::endl;
 }
 
@@ -118,7 +147,6 @@ ModelCoupled<MODEL1, MODEL2>::ModelCoupled(const GeometryCoupled_ & geom,
 template <typename MODEL1, typename MODEL2>
 void ModelCoupled<MODEL1, MODEL2>::initialize(StateCoupled_ & xx) const {
   Log::trace() << "ModelCoupled::initialize starting" << std::endl;
-  checkTimes(xx);
   if (model1_) model1_->initialize(xx.state1());
   if (model2_) model2_->initialize(xx.state2());
   checkTimes(xx);
@@ -131,9 +159,13 @@ template <typename MODEL1, typename MODEL2>
 void ModelCoupled<MODEL1, MODEL2>::step(StateCoupled_ & xx,
                                         const AuxCoupledModel_ & maux) const {
   Log::trace() << "ModelCoupled::step starting" << std::endl;
-  checkTimes(xx);
-  if (model1_) model1_->step(xx.state1(), maux.aux1());
-  if (model2_) model2_->step(xx.state2(), maux.aux2());
+  if (model1_) {
+    for (int js = 0; js < nsteps1_; ++js) model1_->step(xx.state1(), maux.aux1());
+  }
+  if (model2_) {
+    for (int js = 0; js < nsteps2_; ++js) model2_->step(xx.state2(), maux.aux2());
+  }
+  // The models only need to agree at coupling times
   checkTimes(xx);
   Log::trace() << "ModelCoupled::step done" << std::endl;
 }
@@ -143,7 +175,6 @@ void ModelCoupled<MODEL1, MODEL2>::step(StateCoupled_ & xx,
 template <typename MODEL1, typename MODEL2>
 void ModelCoupled<MODEL1, MODEL2>::finalize(StateCoupled_ & xx) const {
   Log::trace() << "ModelCoupled::finalize starting" << std::endl;
-  checkTimes(xx);
   if (model1_) model1_->finalize(xx.state1());
   if (model2_) model2_->finalize(xx.state2());
   checkTimes(xx);
@@ -185,7 +216,7 @@ template <typename MODEL1, typename MODEL2>
 void ModelCoupled<MODEL1, MODEL2>::checkTimes(const StateCoupled_ & xxs) const {
   if (!parallel_) {
     ASSERT(xxs.state1().validTime() == xxs.state2().validTime());
-  } else {
+  } else if (geom_->getCommPairRanks().size() > 1) {
     if (model2_) {
       oops::mpi::send(geom_->getCommPairRanks(), xxs.state2().validTime(), 0, 1234);
     }
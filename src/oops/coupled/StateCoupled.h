@@ -243,6 +243,8 @@ double StateCoupled<MODEL1, MODEL2>::norm() const {
     if (xx1_) zz = xx1_->norm();
     if (xx2_) zz = xx2_->norm();
     geom_->getCommPairRanks().allReduceInPlace(zz, eckit::mpi::Operation::SUM);
+    // Tasks without a partner in the other model get the sum from the first task
+    geom_->getCommModel().broadcast(zz, 0);
   } else {
     zz = xx1_->norm() + xx2_->norm();
   }
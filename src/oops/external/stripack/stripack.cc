@@ -9,6 +9,12 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <numeric>
+#include <string>
 #include <vector>
 
 #include "atlas/util/Geometry.h"
@@ -21,6 +27,29 @@
 
 namespace stripack {
 
+namespace {
+
+const std::int64_t fileVersion = 1;
+
+template <typename T>
+void writeVector(std::ofstream & out, const std::vector<T> & vec) {
+  const std::int64_t size = vec.size();
+  out.write(reinterpret_cast<const char *>(&size), sizeof(size));
+  out.write(reinterpret_cast<const char *>(vec.data()), size * sizeof(T));
+}
+
+template <typename T>
+bool readVector(std::ifstream & in, std::vector<T> & vec) {
+  std::int64_t size = -1;
+  in.read(reinterpret_cast<char *>(&size), sizeof(size));
+  if (!in || size < 0) return false;
+  vec.resize(size);
+  in.read(reinterpret_cast<char *>(vec.data()), size * sizeof(T));
+  return static_cast<bool>(in);
+}
+
+}  // namespace
+
 Triangulation::Triangulation(const std::vector<double> & lats, const std::vector<double> & lons)
   : num_nodes_(lats.size()),
     xs_(num_nodes_),
@@ -72,6 +101,67 @@ Triangulation::Triangulation(const std::vector<double> & lats, const std::vector
       near_.data(), next_.data(), dist_.data());
 }
 
+std::unique_ptr<Triangulation> Triangulation::read(const std::string & filename,
+                                                   const std::vector<double> & lats,
+                                                   const std::vector<double> & lons) {
+  ASSERT(lats.size() == lons.size());
+  std::ifstream in(filename, std::ios::binary);
+  if (!in.is_open()) return nullptr;
+
+  std::int64_t version = 0;
+  in.read(reinterpret_cast<char *>(&version), sizeof(version));
+  if (!in || version != fileVersion) return nullptr;
+
+  std::unique_ptr<Triangulation> tri(new Triangulation());
+  std::vector<int> lnew(1);
+  const bool ok = readVector(in, tri->xs_) && readVector(in, tri->ys_) && readVector(in, tri->zs_)
+               && readVector(in, tri->random_permutation_)
+               && readVector(in, tri->inverse_random_permutation_)
+               && readVector(in, tri->list_) && readVector(in, tri->lptr_)
+               && readVector(in, tri->lend_) && readVector(in, lnew);
+  if (!ok || lnew.size() != 1) return nullptr;
+
+  // Check the triangulation was built from the same points (in the same order)
+  const size_t nn = lats.size();
+  tri->num_nodes_ = nn;
+  if (tri->xs_.size() != nn || tri->ys_.size() != nn || tri->zs_.size() != nn
+      || tri->random_permutation_.size() != nn || tri->inverse_random_permutation_.size() != nn
+      || tri->lend_.size() != nn) return nullptr;
+  const atlas::Geometry unitsphere(1.0);
+  for (size_t i = 0; i < nn; ++i) {
+    const size_t ip = tri->inverse_random_permutation_[i];
+    if (ip >= nn) return nullptr;
+    atlas::PointLonLat ptll(lons[ip], lats[ip]);
+    ptll.normalise();
+    atlas::Point3 pt3;
+    unitsphere.lonlat2xyz(ptll, pt3);
+    if (std::abs(tri->xs_[i] - pt3[0]) > 1.0e-12 || std::abs(tri->ys_[i] - pt3[1]) > 1.0e-12
+        || std::abs(tri->zs_[i] - pt3[2]) > 1.0e-12) return nullptr;
+  }
+
+  tri->lnew_ = lnew[0];
+  tri->near_.assign(nn, 0);
+  tri->next_.assign(nn, 0);
+  tri->dist_.assign(nn, 0.0);
+  return tri;
+}
+
+void Triangulation::write(const std::string & filename) const {
+  std::ofstream out(filename, std::ios::binary);
+  if (!out.is_open()) throw eckit::CantOpenFile(filename, Here());
+  out.write(reinterpret_cast<const char *>(&fileVersion), sizeof(fileVersion));
+  writeVector(out, xs_);
+  writeVector(out, ys_);
+  writeVector(out, zs_);
+  writeVector(out, random_permutation_);
+  writeVector(out, inverse_random_permutation_);
+  writeVector(out, list_);
+  writeVector(out, lptr_);
+  writeVector(out, lend_);
+  writeVector(out, std::vector<int>(1, lnew_));
+  if (!out) throw eckit::WriteError(filename, Here());
+}
+
 bool Triangulation::containingTriangleAndBarycentricCoords(
       const std::array<double, 3> & coords,
       const int guess_index,
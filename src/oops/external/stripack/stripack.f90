@@ -854,6 +854,7 @@ integer,intent(out) :: i3          !< Third counterclockwise-ordered vertex inde
 ! Local variables
 integer :: lp,n0,n1,n1s,n2,n2s,n3,n4,next,nf,nl
 integer,save :: ix = 1,iy = 2,iz = 3
+!$omp threadprivate(ix,iy,iz)
 real(kind_real) :: output,eps,ptn1,ptn2,q(3),s12,tol,xp,yp,zp
 
 ! Initialize variables.
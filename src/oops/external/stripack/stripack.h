@@ -8,6 +8,8 @@
 #pragma once
 
 #include <array>
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "atlas/util/Geometry.h"
@@ -29,6 +31,14 @@ class Triangulation {
  public:
   Triangulation(const std::vector<double> & lats, const std::vector<double> & lons);
 
+  /// Reads a triangulation saved by write. Returns nullptr if the file can't be read or was not
+  /// built from the same points.
+  static std::unique_ptr<Triangulation> read(const std::string & filename,
+                                             const std::vector<double> & lats,
+                                             const std::vector<double> & lons);
+  /// Saves the triangulation to a binary file
+  void write(const std::string & filename) const;
+
   /// Returns true if there is a containing triangle; false if point is outside triangulation
   bool containingTriangleAndBarycentricCoords(
       const std::array<double, 3> & coords,
@@ -37,6 +47,8 @@ class Triangulation {
       std::array<double, 3> & barycentricCoords) const;
 
  private:
+  Triangulation() = default;
+
   // Triangulation data to use in C++
   size_t num_nodes_;
   std::vector<double> xs_;
@@ -49,7 +61,7 @@ class Triangulation {
   std::vector<int> list_;
   std::vector<int> lptr_;
   std::vector<int> lend_;
-  int lnew_;
+  int lnew_ = 0;
   // Allocations for STRIPACK workspaces; should not read from C++
   std::vector<int> near_;
   std::vector<int> next_;
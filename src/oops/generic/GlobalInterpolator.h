@@ -10,6 +10,7 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "atlas/field.h"
@@ -18,6 +19,7 @@
 #include "atlas/util/KDTree.h"
 
 #include "eckit/config/Configuration.h"
+#include "eckit/mpi/Comm.h"
 
 #include "oops/base/Variables.h"
 #include "oops/generic/UnstructuredInterpolator.h"
@@ -68,10 +70,16 @@ class GlobalInterpolator : public util::Printable {
                           const std::vector<double>&);
 
   void print(std::ostream &) const;
+  void waitAll(std::vector<eckit::mpi::Request> &) const;
 
   const eckit::mpi::Comm & comm_;
-  std::vector<std::vector<size_t>> mytarget_index_by_task_;
-  std::vector<std::unique_ptr<Interp_>> interp_;
+  const int tag_;
+  // Only the tasks that exchange points with this task are stored
+  std::vector<size_t> targetTasks_;  // tasks interpolating some of the local targets
+  std::vector<std::vector<size_t>> mytarget_index_by_task_;  // one per task in targetTasks_
+  std::vector<size_t> interpTasks_;  // tasks for which some targets are interpolated here
+  std::vector<std::unique_ptr<Interp_>> interp_;  // one per task in interpTasks_
+  std::vector<size_t> ninterp_;  // number of targets interpolated here for each of interpTasks_
 };
 
 // -----------------------------------------------------------------------------
@@ -82,7 +90,7 @@ GlobalInterpolator<MODEL>::GlobalInterpolator(
     const typename MODEL::Geometry & source_grid,
     const typename MODEL::Geometry & target_grid,
     const eckit::mpi::Comm & comm)
-  : comm_(comm)
+  : comm_(comm), tag_(5678)
 {
   Log::trace() << "GlobalInterpolator::GlobalInterpolator start" << std::endl;
 
@@ -107,7 +115,7 @@ GlobalInterpolator<MODEL>::GlobalInterpolator(
     const Geometry_ & source_grid,
     const atlas::FunctionSpace & target_fs,
     const eckit::mpi::Comm & comm)
-  : comm_(comm)
+  : comm_(comm), tag_(5678)
 {
   Log::trace() << "GlobalInterpolator::GlobalInterpolator start" << std::endl;
 
@@ -139,32 +147,62 @@ void GlobalInterpolator<MODEL>::setupInterpolators(
   const size_t ntasks = comm_.size();
   const size_t npts = target_lats.size();
 
-  // Exchange target coords, find targets to be interpolated on this task
-  mytarget_index_by_task_.resize(ntasks);
+  // Find task interpolating each target
+  std::vector<std::vector<size_t>> mytarget_index_by_task(ntasks);
   std::vector<std::vector<double>> mytarget_latlon_by_task(ntasks);
   for (size_t jt = 0; jt < npts; ++jt) {
     const size_t itask = source_grid.closestTask(target_lats[jt], target_lons[jt]);
-    mytarget_index_by_task_[itask].push_back(jt);
+    mytarget_index_by_task[itask].push_back(jt);
     mytarget_latlon_by_task[itask].push_back(target_lats[jt]);
     mytarget_latlon_by_task[itask].push_back(target_lons[jt]);
   }
 
-  std::vector<std::vector<double>> mylocs_latlon_by_task(ntasks);
-  comm_.allToAll(mytarget_latlon_by_task, mylocs_latlon_by_task);
+  // Exchange numbers of targets, so that only tasks with targets to exchange communicate
+  std::vector<int> nsend(ntasks);
+  for (size_t jtask = 0; jtask < ntasks; ++jtask) {
+    nsend[jtask] = mytarget_index_by_task[jtask].size();
+  }
+  std::vector<int> nrecv(ntasks);
+  comm_.allToAll(nsend, nrecv);
 
-  interp_.resize(ntasks);
   for (size_t jtask = 0; jtask < ntasks; ++jtask) {
-    const size_t ntargets = mylocs_latlon_by_task[jtask].size() / 2;
+    if (nsend[jtask] > 0) {
+      targetTasks_.push_back(jtask);
+      mytarget_index_by_task_.push_back(std::move(mytarget_index_by_task[jtask]));
+    }
+    if (nrecv[jtask] > 0) {
+      interpTasks_.push_back(jtask);
+      ninterp_.push_back(nrecv[jtask]);
+    }
+  }
+
+  // Exchange target coords with these tasks only
+  std::vector<std::vector<double>> mylocs_latlon_by_task(interpTasks_.size());
+  std::vector<eckit::mpi::Request> reqs;
+  for (size_t jj = 0; jj < interpTasks_.size(); ++jj) {
+    mylocs_latlon_by_task[jj].resize(2 * ninterp_[jj]);
+    reqs.push_back(comm_.iReceive(mylocs_latlon_by_task[jj].data(),
+                                  mylocs_latlon_by_task[jj].size(), interpTasks_[jj], tag_));
+  }
+  for (const size_t jtask : targetTasks_) {
+    reqs.push_back(comm_.iSend(mytarget_latlon_by_task[jtask].data(),
+                               mytarget_latlon_by_task[jtask].size(), jtask, tag_));
+  }
+  waitAll(reqs);
+
+  interp_.resize(interpTasks_.size());
+  for (size_t jj = 0; jj < interpTasks_.size(); ++jj) {
+    const size_t ntargets = ninterp_[jj];
     std::vector<double> lats(ntargets);
     std::vector<double> lons(ntargets);
     size_t ii = 0;
     for (size_t jt = 0; jt < ntargets; ++jt) {
-      lats[jt] = mylocs_latlon_by_task[jtask][ii];
-      lons[jt] = mylocs_latlon_by_task[jtask][ii + 1];
+      lats[jt] = mylocs_latlon_by_task[jj][ii];
+      lons[jt] = mylocs_latlon_by_task[jj][ii + 1];
       ii += 2;
     }
-    ASSERT(mylocs_latlon_by_task[jtask].size() == ii);
-    interp_[jtask].reset(new Interp_(config, source_grid, lats, lons));
+    ASSERT(mylocs_latlon_by_task[jj].size() == ii);
+    interp_[jj].reset(new Interp_(config, source_grid, lats, lons));
   }
 }
 
@@ -193,26 +231,31 @@ void GlobalInterpolator<MODEL>::apply(const atlas::FieldSet & source,
     vars.push_back(field.name());
   }
 
-  const size_t ntasks = comm_.size();
-
-  std::vector<std::vector<double>> locinterp(ntasks);
-  for (size_t jtask = 0; jtask < ntasks; ++jtask) {
-    interp_[jtask]->apply(vars, source, locinterp[jtask]);
+  // Post receives of the values interpolated for local targets
+  std::vector<std::vector<double>> recvinterp(targetTasks_.size());
+  std::vector<eckit::mpi::Request> recvReqs;
+  for (size_t jj = 0; jj < targetTasks_.size(); ++jj) {
+    recvinterp[jj].resize(mytarget_index_by_task_[jj].size() * nvars);
+    recvReqs.push_back(comm_.iReceive(recvinterp[jj].data(), recvinterp[jj].size(),
+                                      targetTasks_[jj], tag_));
   }
 
-  // Gather results across MPI ranks
-  std::vector<std::vector<double>> recvinterp(ntasks);
-  comm_.allToAll(locinterp, recvinterp);
+  // Interpolate and send results to the tasks they are needed on
+  std::vector<std::vector<double>> locinterp(interpTasks_.size());
+  std::vector<eckit::mpi::Request> sendReqs;
+  for (size_t jj = 0; jj < interpTasks_.size(); ++jj) {
+    interp_[jj]->apply(vars, source, locinterp[jj]);
+    ASSERT(locinterp[jj].size() == ninterp_[jj] * nvars);
+    sendReqs.push_back(comm_.iSend(locinterp[jj].data(), locinterp[jj].size(),
+                                   interpTasks_[jj], tag_));
+  }
+  waitAll(recvReqs);
 
   // Copy data from vector<double> to atlas::FieldSet
-  for (size_t jtask = 0; jtask < ntasks; ++jtask) {
-    const size_t nvals = mytarget_index_by_task_[jtask].size() * nvars;
-    ASSERT(recvinterp[jtask].size() == nvals);
-    if (nvals > 0) {
-      Interp_::bufferToFieldSet(vars, mytarget_index_by_task_[jtask],
-                                                        recvinterp[jtask], target);
-    }
+  for (size_t jj = 0; jj < targetTasks_.size(); ++jj) {
+    Interp_::bufferToFieldSet(vars, mytarget_index_by_task_[jj], recvinterp[jj], target);
   }
+  waitAll(sendReqs);
 }
 
 // -----------------------------------------------------------------------------
@@ -240,26 +283,41 @@ void GlobalInterpolator<MODEL>::applyAD(atlas::FieldSet & source,
     vars.push_back(field.name());
   }
 
-  const size_t ntasks = comm_.size();
-
-  // (Adjoint of) Copy data from vector<double> to atlas::FieldSet
-  std::vector<std::vector<double>> recvinterp(ntasks);
-  for (size_t jtask = 0; jtask < ntasks; ++jtask) {
-    const size_t nvals = mytarget_index_by_task_[jtask].size() * nvars;
-    recvinterp[jtask].resize(nvals, 0.0);
-    if (nvals > 0) {
-      Interp_::bufferToFieldSetAD(vars, mytarget_index_by_task_[jtask],
-                                                          recvinterp[jtask], target);
-    }
+  // (Adjoint of) Interpolate and send results: receive sensitivities to interpolated values
+  std::vector<std::vector<double>> locinterp(interpTasks_.size());
+  std::vector<eckit::mpi::Request> recvReqs;
+  for (size_t jj = 0; jj < interpTasks_.size(); ++jj) {
+    locinterp[jj].resize(ninterp_[jj] * nvars);
+    recvReqs.push_back(comm_.iReceive(locinterp[jj].data(), locinterp[jj].size(),
+                                      interpTasks_[jj], tag_));
   }
 
-  // (Adjoint of) Gather results across MPI ranks
-  std::vector<std::vector<double>> locinterp(ntasks);
-  comm_.allToAll(recvinterp, locinterp);
+  // (Adjoint of) Copy data from vector<double> to atlas::FieldSet and send it
+  std::vector<std::vector<double>> recvinterp(targetTasks_.size());
+  std::vector<eckit::mpi::Request> sendReqs;
+  for (size_t jj = 0; jj < targetTasks_.size(); ++jj) {
+    recvinterp[jj].resize(mytarget_index_by_task_[jj].size() * nvars, 0.0);
+    Interp_::bufferToFieldSetAD(vars, mytarget_index_by_task_[jj], recvinterp[jj], target);
+    sendReqs.push_back(comm_.iSend(recvinterp[jj].data(), recvinterp[jj].size(),
+                                   targetTasks_[jj], tag_));
+  }
+  waitAll(recvReqs);
 
   // (Adjoint of) Interpolate
-  for (size_t jtask = 0; jtask < ntasks; ++jtask) {
-    interp_[jtask]->applyAD(vars, source, locinterp[jtask]);
+  for (size_t jj = 0; jj < interpTasks_.size(); ++jj) {
+    interp_[jj]->applyAD(vars, source, locinterp[jj]);
+  }
+  waitAll(sendReqs);
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename MODEL>
+void GlobalInterpolator<MODEL>::waitAll(std::vector<eckit::mpi::Request> & reqs) const
+{
+  for (eckit::mpi::Request & req : reqs) {
+    const eckit::mpi::Status st = comm_.wait(req);
+    ASSERT(st.error() == 0);
   }
 }
 
@@ -10,6 +10,8 @@
 
 #include <Eigen/Geometry>
 #include <Eigen/SVD>
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <string>
 #include <vector>
@@ -98,103 +100,123 @@ vars_(vars),
 
 // Runs the coefficient calculation looping over variables and grid points,
 // also sizes the field set to store coefficient vectors and copies them.
+// The ensemble is first packed so that, for each variable and grid point, all members
+// are contiguous; the independent per-gridpoint regressions are then shared between
+// OpenMP threads, each with its own preallocated work space. Grid points are already
+// distributed across MPI tasks with the increment geometry.
 template<typename MODEL>
 void HtlmCalculator<MODEL>::calcCoeffs(const std::vector<Increment_> & linearEnsemble,
                                        const std::vector<Increment_> & linearErrorDe,
                                        atlas::FieldSet & coeffFieldSet) {
   Log::trace() << "HtlmCalculator<MODEL>::coeffCalc() starting" << std::endl;
+  typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> Matrix_;
+  typedef Eigen::Matrix<double, Eigen::Dynamic, 1> Vector_;
+  const atlas::idx_t nvars = vars_.size();
+  const atlas::idx_t ncoeffs = influenceSize_*nvars;
+
+  // Pack ensemble: packedEns[var](ensInd, i*vertExt_+k)
+  std::vector<Matrix_> packedEns(nvars, Matrix_(ensembleSize_, horizExt_*vertExt_));
+  for (atlas::idx_t varInd2 = 0; varInd2 < nvars; ++varInd2) {
+    for (atlas::idx_t ensInd = 0; ensInd < ensembleSize_; ++ensInd) {
+      const auto linearEnsembleView =
+        atlas::array::make_view<double, 2>(linearEnsemble[ensInd].fieldSet()[vars_[varInd2]]);
+      for (atlas::idx_t i = 0; i < horizExt_; ++i) {
+        for (atlas::idx_t k = 0; k < vertExt_; ++k) {
+          packedEns[varInd2](ensInd, i*vertExt_+k) = linearEnsembleView(i, k);
+        }
+      }
+    }
+  }
+  Matrix_ packedErr(ensembleSize_, horizExt_*vertExt_);
+
   // For each variable loop over every grid point and calculate the coefficient vector for each
-  for (size_t varInd = 0; varInd < vars_.size(); ++varInd) {
+  for (atlas::idx_t varInd = 0; varInd < nvars; ++varInd) {
      // make field set with size to store coefficient vectors
       atlas::Field
          coeffField(vars_[varInd], atlas::array::make_datatype<double>(),
-            atlas::array::make_shape(horizExt_, vertExt_, vars_.size() * influenceSize_));
+            atlas::array::make_shape(horizExt_, vertExt_, ncoeffs));
       coeffFieldSet.add(coeffField);
     // get rms by level scaling
       const std::vector<double> rmsVals =
         params_.rms ? linearEnsemble[0].rmsByLevel(vars_[varInd]) : std::vector<double>{};
+    // pack linear error for this variable
+    for (atlas::idx_t ensInd = 0; ensInd < ensembleSize_; ++ensInd) {
+      const auto linErrView =
+        atlas::array::make_view<double, 2>(linearErrorDe[ensInd].fieldSet()[vars_[varInd]]);
+      for (atlas::idx_t i = 0; i < horizExt_; ++i) {
+        for (atlas::idx_t k = 0; k < vertExt_; ++k) {
+          packedErr(ensInd, i*vertExt_+k) =
+            params_.rms ? linErrView(i, k)/rmsVals[k] : linErrView(i, k);
+        }
+      }
+    }
+    auto coeffsView = atlas::array::make_view<double, 3>(coeffFieldSet[vars_[varInd]]);
+
     // calculate coefficient vector for each grid point
-    for (atlas::idx_t i = 0; i < horizExt_; ++i) {
-      for (atlas::idx_t k = 0; k < vertExt_; ++k) {
-        // matrices used for calculation of coeffs and storage
-        // a set for each grid point for future parallelization
-        Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>
-                 influenceMat(influenceSize_*vars_.size(), ensembleSize_);
-        Eigen::Matrix<double, Eigen::Dynamic, 1> linErrVec(ensembleSize_);
-        Eigen::Matrix<double, Eigen::Dynamic, 1> coeffVect(influenceSize_*vars_.size());
-
-        // Populate influenceMat (M) and linErrVec (delta e) declared in class
-        Log::trace() << "HtlmCalculator<MODEL>::coeffCalc() filling matrices starting"
-                                                                            << std::endl;
-        for (atlas::idx_t ensInd = 0; ensInd < ensembleSize_; ++ensInd) {
-          // populate linErrVec
-          const atlas::FieldSet & linearEnsembleFset = linearEnsemble[ensInd].fieldSet();
-          const atlas::FieldSet & linErrFset = linearErrorDe[ensInd].fieldSet();
-          const auto linErrView = atlas::array::make_view<double, 2>(linErrFset[vars_[varInd]]);
-          if (params_.rms) {
-            linErrVec(ensInd, 0) = linErrView(i, k)/rmsVals[k];
-          } else {
-            linErrVec(ensInd, 0) = linErrView(i, k);
+#ifdef _OPENMP
+    #pragma omp parallel
+#endif
+    {
+      // work space reused for all grid points handled by this thread
+      Matrix_ influenceMat = Matrix_::Zero(ncoeffs, ensembleSize_);
+      Matrix_ normalMat(ncoeffs, ncoeffs);
+      Vector_ linErrVec(ensembleSize_);
+      Vector_ rhs(ncoeffs);
+      Vector_ coeffVect(ncoeffs);
+      Eigen::BDCSVD<Matrix_> bdc_svd_solver(ncoeffs, ncoeffs,
+                                            Eigen::ComputeFullU | Eigen::ComputeFullV);
+
+#ifdef _OPENMP
+      #pragma omp for schedule(static)
+#endif
+      for (atlas::idx_t i = 0; i < horizExt_; ++i) {
+        for (atlas::idx_t k = 0; k < vertExt_; ++k) {
+          // first level of the influence region for grid point at i,k
+          atlas::idx_t kInf = k-halfInfluenceSize_;
+          if (k-halfInfluenceSize_ <= 0) {
+            // start of increment edge case
+            kInf = 0;
+          } else if (k+halfInfluenceSize_ >= vertExt_) {
+            // end of increment edge case
+            kInf = vertExt_-influenceSize_;
           }
-          // populate influenceMat
-          for (size_t varInd2 = 0; varInd2 < vars_.size(); ++varInd2) {
-            const auto linearEnsembleView =
-              atlas::array::make_view<double, 2>(linearEnsembleFset[vars_[varInd2]]);
+
+          // Populate influenceMat (M) and linErrVec (delta e)
+          linErrVec = packedErr.col(i*vertExt_+k);
+          for (atlas::idx_t varInd2 = 0; varInd2 < nvars; ++varInd2) {
             for (atlas::idx_t infInd = 0; infInd < influenceSize_; ++infInd) {
-              if (k-halfInfluenceSize_ > 0 &&
-                      k + halfInfluenceSize_ < linearEnsembleView.shape(1) ) {
-                // middle case
-                influenceMat(vars_.size()*varInd2 + infInd, ensInd) =
-                        linearEnsembleView(i, k-halfInfluenceSize_ + infInd);
-              } else if (k-halfInfluenceSize_ <= 0) {
-                // start of increment edge case
-                influenceMat(vars_.size()*varInd2 + infInd, ensInd) =
-                                                    linearEnsembleView(i, infInd);
-              } else if (k+halfInfluenceSize_ >= linearEnsembleView.shape(1)) {
-                // end of increment edge case
-                influenceMat(vars_.size()*varInd2 + infInd, ensInd) =
-                    linearEnsembleView(i, (linearEnsembleView.shape(1)-influenceSize_) + infInd);
-              } else {
-                // Checking cases are correct
-                Log::info() << "HtlmCalculator<MODEL>::coeffCalc() "
-                              "unable to get influence region" << std::endl;
-                abort();
-              }  // end else
-            }   // end infInd
-          }   // end varInd2
-        }   // end ensInd
-        Log::trace() << "HtlmCalculator<MODEL>::coeffCalc() filling matrices done" << std::endl;
-
-        // Calculate the coefficient vector for grid point at i,k
-        Log::trace() << "HtlmCalculator<MODEL>::coeffCalc() calculating coefficients starting"
-                                                                                    << std::endl;
-        // Calculate the coefficient vector coeffVect for the grid point at i,k using
-        // influenceMat (M) and linErrVec (delta e) declared in class
-        const auto normalMat = influenceMat*influenceMat.transpose();
-        const auto bdc_svd_solver =
-                   Eigen::BDCSVD<Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic>>
-                                          (normalMat, Eigen::ComputeFullU | Eigen::ComputeFullV);
-        Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> singularValues =
-                                                  bdc_svd_solver.singularValues().asDiagonal();
-        const auto U = bdc_svd_solver.matrixU();
-        // calculate singleValues+lambdaI
-        for (int ij = 0; ij < singularValues.cols(); ++ij) {
-          singularValues(ij, ij)+=lambda_;
-        }
-        const auto pseudoInv = singularValues.completeOrthogonalDecomposition().pseudoInverse();
-        coeffVect = U*pseudoInv*U.transpose()*influenceMat*linErrVec;
-        Log::trace() << "HtlmCalculator<MODEL>::coeffCalc() calculating coefficients done"
-                                                                              << std::endl;
-
-        // Copy the coeff vect into the its field set.
-        Log::trace() << "HtlmCalculator<MODEL>::coeffCalc() placing vector starting" << std::endl;
-        auto coeffsView = atlas::array::make_view<double, 3>(coeffFieldSet[vars_[varInd]]);
-        for (atlas::idx_t coeffInd = 0; coeffInd < atlas::idx_t(coeffVect.size()); ++coeffInd) {
-          coeffsView(i, k, coeffInd) = coeffVect[coeffInd];
-        }
-        Log::trace() << "HtlmCalculator<MODEL>::coeffCalc() placing vector done" << std::endl;
-      }  //  end for k
-    }  //  end for i
+              influenceMat.row(nvars*varInd2 + infInd) =
+                packedEns[varInd2].col(i*vertExt_+kInf+infInd).transpose();
+            }
+          }
+
+          // Calculate the coefficient vector coeffVect for the grid point at i,k
+          // coeffVect = U*(S+lambda*I)^+*U^T*M*e with U*S*V^T the SVD of M*M^T
+          normalMat.noalias() = influenceMat*influenceMat.transpose();
+          bdc_svd_solver.compute(normalMat);
+          const Vector_ & singularValues = bdc_svd_solver.singularValues();
+          const Matrix_ & U = bdc_svd_solver.matrixU();
+          rhs.noalias() = U.transpose()*(influenceMat*linErrVec);
+          // pseudo-inverse of the diagonal (singularValues+lambda), same threshold as
+          // Eigen's complete orthogonal decomposition
+          double maxDiag = 0.0;
+          for (atlas::idx_t ij = 0; ij < ncoeffs; ++ij) {
+            maxDiag = std::max(maxDiag, std::abs(singularValues(ij) + lambda_));
+          }
+          const double threshold = maxDiag*Eigen::NumTraits<double>::epsilon()*ncoeffs;
+          for (atlas::idx_t ij = 0; ij < ncoeffs; ++ij) {
+            const double diag = singularValues(ij) + lambda_;
+            rhs(ij) = std::abs(diag) > threshold ? rhs(ij)/diag : 0.0;
+          }
+          coeffVect.noalias() = U*rhs;
+
+          // Copy the coeff vect into the its field set.
+          for (atlas::idx_t coeffInd = 0; coeffInd < ncoeffs; ++coeffInd) {
+            coeffsView(i, k, coeffInd) = coeffVect[coeffInd];
+          }
+        }  //  end for k
+      }  //  end for i
+    }  //  end omp parallel
   }  //  end for varInd
   Log::trace() << "HtlmCalculator<MODEL>::coeffCalc() done" << std::endl;
 }
@@ -61,6 +61,10 @@ class HtlmEnsembleParameters : public Parameters {
 };
 
 // class declarations for htlmensemble
+// Members are not distributed over tasks or task groups: every task of the geometry
+// communicator holds the control and all perturbed members, since the HTLM calculator
+// needs the whole ensemble at each of its gridpoints. Only the stepping is shared,
+// when the model has a batched step all members are run together in one forecast.
 template <typename MODEL>
 class HtlmEnsemble{
   typedef Geometry<MODEL>                               Geometry_;
@@ -165,12 +169,25 @@ void HtlmEnsemble<MODEL>::step(const util::Duration & tstep)  {
     Log::trace() << "HtlmEnsemble<MODEL>::step() starting" << std::endl;
     State_ downsampled_Control(incrementGeometry_, controlState_);
     simpleLinearModel_.setTrajectory(controlState_, downsampled_Control, moderr_);
-    PostProcessor<State_> post;
-    model_.forecast(controlState_, moderr_, tstep, post);
-
-    for (size_t m = 0; m < ensembleSize_; ++m) {
-        model_.forecast(perturbedStates_[m], moderr_, tstep, post);
-        simpleLinearModel_.forecastTL(linearEnsemble_[m], modauxinc_, tstep);
+    if (model_.hasBatchedStep()) {
+        // Step the control and perturbed members together
+        std::vector<State_ *> members;
+        members.reserve(ensembleSize_ + 1);
+        members.push_back(&controlState_);
+        for (size_t m = 0; m < ensembleSize_; ++m) members.push_back(&perturbedStates_[m]);
+        std::vector<PostProcessor<State_>> posts(ensembleSize_ + 1);
+        model_.forecastEnsemble(members, moderr_, tstep, posts);
+        for (size_t m = 0; m < ensembleSize_; ++m) {
+            simpleLinearModel_.forecastTL(linearEnsemble_[m], modauxinc_, tstep);
+        }
+    } else {
+        PostProcessor<State_> post;
+        model_.forecast(controlState_, moderr_, tstep, post);
+
+        for (size_t m = 0; m < ensembleSize_; ++m) {
+            model_.forecast(perturbedStates_[m], moderr_, tstep, post);
+            simpleLinearModel_.forecastTL(linearEnsemble_[m], modauxinc_, tstep);
+        }
     }
     for (size_t m = 0; m < ensembleSize_; ++m) {
         nonLinearDifferences_[m].updateTime(tstep);
@@ -9,6 +9,7 @@
 #ifndef OOPS_GENERIC_HYBRIDLINEARMODELCOEFFS_H_
 #define OOPS_GENERIC_HYBRIDLINEARMODELCOEFFS_H_
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <string>
@@ -73,9 +74,8 @@ class HybridLinearModelCoeffs{
   void updateIncAD(Increment_ &) const;
 
  private:
-  std::vector<double> getInfluenceVec(const atlas::FieldSet &,
-                                        const atlas::idx_t & i,
-                                        const atlas::idx_t & k) const;
+  void getInfluenceVec(const atlas::FieldSet &, const atlas::idx_t & i,
+                       const atlas::idx_t & k, std::vector<double> &) const;
 
  private:
   std::map<util::DateTime, atlas::FieldSet> coeffSaver_;
@@ -127,22 +127,32 @@ template<typename MODEL>
 void HybridLinearModelCoeffs<MODEL>::updateIncTL(Increment_ & dx) const {
   Log::trace() << "HybridLinearModelCoeffs<MODEL::updateIncTL() starting" << std::endl;
   atlas::FieldSet & dxFset = dx.fieldSet();
+  const atlas::FieldSet & coeffFset = coeffSaver_.at(dx.validTime());
   for (size_t varInd = 0; varInd < vars_.size(); ++varInd) {
     auto dxView = atlas::array::make_view<double, 2>(dxFset[vars_[varInd]]);
-    for (atlas::idx_t i = 0; i < dxView.shape(0); ++i) {
-      std::vector<double> updateVal(dxView.shape(1), 0.0);
-
-      for (atlas::idx_t k = 0; k < dxView.shape(1); ++k) {
-        std::vector<double> dxVec = getInfluenceVec(dxFset, i, k);
-
-        auto coeffView = atlas::array::make_view<double, 3>
-                                        (coeffSaver_.at(dx.validTime())[vars_[varInd]]);
-        for (atlas::idx_t infInd = 0; infInd < atlas::idx_t(dxVec.size()); ++infInd) {
-          updateVal[k] += coeffView(i, k, infInd)*dxVec[infInd];
+    const auto coeffView = atlas::array::make_view<double, 3>(coeffFset[vars_[varInd]]);
+    const atlas::idx_t nlevs = dxView.shape(1);
+#ifdef _OPENMP
+    #pragma omp parallel
+#endif
+    {
+      // work space reused for all grid points handled by this thread
+      std::vector<double> updateVal(nlevs);
+      std::vector<double> dxVec(influenceSize_*vars_.size());
+#ifdef _OPENMP
+      #pragma omp for schedule(static)
+#endif
+      for (atlas::idx_t i = 0; i < dxView.shape(0); ++i) {
+        for (atlas::idx_t k = 0; k < nlevs; ++k) {
+          getInfluenceVec(dxFset, i, k, dxVec);
+          updateVal[k] = 0.0;
+          for (atlas::idx_t infInd = 0; infInd < atlas::idx_t(dxVec.size()); ++infInd) {
+            updateVal[k] += coeffView(i, k, infInd)*dxVec[infInd];
+          }
+        }
+        for (atlas::idx_t k = 0; k < nlevs; ++k) {
+          dxView(i, k) += updateVal[k];
         }
-      }
-      for (atlas::idx_t k = 0; k < dxView.shape(1); ++k) {
-        dxView(i, k) += updateVal[k];
       }
     }
   }
@@ -156,40 +166,39 @@ void HybridLinearModelCoeffs<MODEL>::updateIncTL(Increment_ & dx) const {
 template<typename MODEL>
 void HybridLinearModelCoeffs<MODEL>::updateIncAD(Increment_ & dx) const {
   Log::trace() << "HybridLinearModelCoeffs<MODEL::updateIncAD() starting" << std::endl;
-    atlas::FieldSet & dxFset = dx.fieldSet();
+  atlas::FieldSet & dxFset = dx.fieldSet();
+  const atlas::FieldSet & coeffFset = coeffSaver_.at(dx.validTime());
   for (size_t varInd = 0; varInd < vars_.size(); ++varInd) {
     auto dxView = atlas::array::make_view<double, 2>(dxFset[vars_[varInd]]);
-    for (atlas::idx_t i = 0; i < dxView.shape(0); ++i) {
-      std::vector<double> updateVal(dxView.shape(1), 0.0);
-      for (atlas::idx_t k = 0; k < dxView.shape(1); ++k) {
-        auto coeffView = atlas::array::make_view<double, 3>
-                                        (coeffSaver_.at(dx.validTime())[vars_[varInd]]);
-        if (k-halfInfluenceSize_ > 0 && k+halfInfluenceSize_ < dxView.shape(1)) {
-          for (int infInd = 0; infInd < influenceSize_; infInd++)
-          {
-            updateVal[k+infInd-halfInfluenceSize_]+= coeffView(i, k, infInd)*dxView(i, k);
-          }
-
-        } else if (k-halfInfluenceSize_ <= 0) {
-          for (int infInd= 0; infInd < influenceSize_; infInd++)
-          {
-            updateVal[infInd]+= coeffView(i, k, infInd)*dxView(i, k);
+    const auto coeffView = atlas::array::make_view<double, 3>(coeffFset[vars_[varInd]]);
+    const atlas::idx_t nlevs = dxView.shape(1);
+#ifdef _OPENMP
+    #pragma omp parallel
+#endif
+    {
+      // work space reused for all grid points handled by this thread
+      std::vector<double> updateVal(nlevs);
+#ifdef _OPENMP
+      #pragma omp for schedule(static)
+#endif
+      for (atlas::idx_t i = 0; i < dxView.shape(0); ++i) {
+        std::fill(updateVal.begin(), updateVal.end(), 0.0);
+        for (atlas::idx_t k = 0; k < nlevs; ++k) {
+          atlas::idx_t kInf = k-halfInfluenceSize_;
+          if (k-halfInfluenceSize_ <= 0) {
+            // start of increment edge case
+            kInf = 0;
+          } else if (k+halfInfluenceSize_ >= nlevs) {
+            // end of increment edge case
+            kInf = nlevs-influenceSize_;
           }
-        } else if (k+halfInfluenceSize_ >= dxView.shape(1)) {
-          for (int infInd= 0; infInd < influenceSize_; infInd++)
-          {
-            updateVal[(dxView.shape(1)-influenceSize_+infInd)]+=
-                                             coeffView(i, k, infInd)*dxView(i, k);
+          for (atlas::idx_t infInd = 0; infInd < influenceSize_; infInd++) {
+            updateVal[kInf+infInd] += coeffView(i, k, infInd)*dxView(i, k);
           }
-        } else {
-            // Checking cases are correct
-            Log::info() << "HybridLinearModelCoeffs<MODEL>::updateIncAD() "
-                           "unable to get influence region AD" << std::endl;
-            abort();
         }
-      }
-      for (atlas::idx_t k = 0; k < dxView.shape(1); ++k) {
-        dxView(i, k) += updateVal[k];
+        for (atlas::idx_t k = 0; k < nlevs; ++k) {
+          dxView(i, k) += updateVal[k];
+        }
       }
     }
   }
@@ -198,35 +207,26 @@ void HybridLinearModelCoeffs<MODEL>::updateIncAD(Increment_ & dx) const {
 }
 
 //------------------------------------------------------------------------------
-// creates influence region vector for grid point dx, gets points above and below for all vars
+// fills influence region vector for grid point dx, gets points above and below for all vars
 template<typename MODEL>
-std::vector<double> HybridLinearModelCoeffs<MODEL>::getInfluenceVec(const atlas::FieldSet & dxFset,
-                                                           const atlas::idx_t & i,
-                                                           const atlas::idx_t & k) const {
-  Log::trace() << "HybridLinearModelCoeffs<MODEL>::getInfluenceVec() starting" << std::endl;
-  std::vector<double> dxVec(influenceSize_*vars_.size());
+void HybridLinearModelCoeffs<MODEL>::getInfluenceVec(const atlas::FieldSet & dxFset,
+                                                     const atlas::idx_t & i,
+                                                     const atlas::idx_t & k,
+                                                     std::vector<double> & dxVec) const {
   for (size_t varInd = 0; varInd < vars_.size(); ++varInd) {
     const auto dxFview = atlas::array::make_view<double, 2>(dxFset[vars_[varInd]]);
-      for (atlas::idx_t infInd = 0; infInd < influenceSize_; ++infInd) {
-        if (k-halfInfluenceSize_ > 0 && k + halfInfluenceSize_ < dxFview.shape(1)) {
-          // middle case
-          dxVec[vars_.size()*varInd + infInd] = dxFview(i, k-halfInfluenceSize_ + infInd);
-        } else if (k-halfInfluenceSize_ <= 0) {
-          // start of increment edge case
-          dxVec[vars_.size()*varInd + infInd] = dxFview(i, infInd);
-        } else if (k+halfInfluenceSize_ >= dxFview.shape(1)) {
-          // end of increment edge case
-          dxVec[vars_.size()*varInd + infInd] =
-                              dxFview(i, (dxFview.shape(1)-influenceSize_) + infInd);
-        } else {
-          // Checking cases are correct
-          Log::info() << "HybridLinearModelCoeffs<MODEL>::getInfluenceVec() "
-                         "unable to get influence region" << std::endl;
-          abort();
-        }
-      }
+    atlas::idx_t kInf = k-halfInfluenceSize_;
+    if (k-halfInfluenceSize_ <= 0) {
+      // start of increment edge case
+      kInf = 0;
+    } else if (k+halfInfluenceSize_ >= dxFview.shape(1)) {
+      // end of increment edge case
+      kInf = dxFview.shape(1)-influenceSize_;
+    }
+    for (atlas::idx_t infInd = 0; infInd < influenceSize_; ++infInd) {
+      dxVec[vars_.size()*varInd + infInd] = dxFview(i, kInf + infInd);
+    }
   }
-    return dxVec;
 }
 //------------------------------------------------------------------------------
 
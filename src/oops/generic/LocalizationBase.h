@@ -15,6 +15,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <boost/noncopyable.hpp>
 
@@ -53,6 +54,13 @@ class LocalizationBase : public util::Printable,
   virtual void randomize(Increment_ & dx) const = 0;
   /// Apply 3D localization to \p dx
   virtual void multiply(Increment_ & dx) const = 0;
+  /// Apply 3D localization to all increments in \p dxs (by default one at a time,
+  /// implementations can override to process the members together)
+  virtual void multiplyEnsemble(std::vector<Increment_> & dxs) const {
+    for (Increment_ & dx : dxs) this->multiply(dx);
+  }
+  /// True if multiplyEnsemble processes the members together rather than one at a time
+  virtual bool hasBatchedMultiply() const {return false;}
 };
 
 // -----------------------------------------------------------------------------
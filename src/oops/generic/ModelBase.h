@@ -75,6 +75,14 @@ class ModelBase : public util::Printable,
   /// \brief Forecast finalization; called after each forecast run
   virtual void finalize(State_ &) const = 0;
 
+  /// \brief Steps all members of an ensemble valid at the same time. By default the
+  /// members are stepped one after the other.
+  virtual void stepEnsemble(std::vector<State_ *> & xx, const ModelAux_ & maux) const {
+    for (State_ * jx : xx) this->step(*jx, maux);
+  }
+  /// \brief Whether stepEnsemble is more efficient than stepping the members in turn
+  virtual bool hasBatchedStep() const {return false;}
+
   /// \brief Time step for running Model's forecast in oops (frequency with which the
   /// State will be updated)
   virtual const util::Duration & timeResolution() const = 0;
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <algorithm>
+#include <exception>
 #include <limits>
 #include <memory>
 #include <numeric>
@@ -109,6 +110,11 @@ class UnstructuredInterpolator : public util::Printable,
     std::vector<bool> targetHasValidStencil;
     std::vector<std::vector<size_t>> stencils;
     std::vector<std::vector<double>> weights;
+    // Transpose (by source point) of the valid stencils, built with the matrix so that the
+    // adjoint can update source points in parallel without write conflicts
+    std::vector<size_t> adjOffsets;
+    std::vector<size_t> adjTargets;
+    std::vector<double> adjWeights;
   };
 
   void applyPerLevel(const InterpMatrix &,
@@ -124,6 +130,7 @@ class UnstructuredInterpolator : public util::Printable,
   void print(std::ostream &) const override;
 
   void computeUnmaskedInterpMatrix(std::vector<double>, std::vector<double>) const;
+  void computeAdjointStencils(InterpMatrix &) const;
   void computeMaskedInterpMatrix(const std::string &,
                                  const atlas::array::ArrayView<double, 2> &) const;
 
@@ -354,57 +361,64 @@ void UnstructuredInterpolator<MODEL>::applyPerLevel(
     const std::vector<bool> & target_mask,
     const atlas::array::ArrayView<double, 2> & gridin,
     std::vector<double>::iterator & gridout, const size_t & ilev) const {
+  // Check the type before the threaded loop, which must not throw
+  if (interp_type != "default" && interp_type != "integer" && interp_type != "nearest") {
+    throw eckit::BadValue("Unknown interpolation type");
+  }
+  const double missing = util::missingValue(double());
+  const auto out = gridout;
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
   for (size_t jloc = 0; jloc < nout_; ++jloc) {
-    if (target_mask[jloc]) {
-      *gridout = 0.0;
+    if (!target_mask[jloc]) continue;
+    double & value = out[jloc];
+    value = 0.0;
 
-      // Edge case: no valid stencil to interpolate to this target => return missingValue
-      if (!interpMatrix.targetHasValidStencil[jloc]) {
-        *gridout = util::missingValue(double());
-        ++gridout;
-        continue;
-      }
+    // Edge case: no valid stencil to interpolate to this target => return missingValue
+    if (!interpMatrix.targetHasValidStencil[jloc]) {
+      value = missing;
+      continue;
+    }
 
-      const std::vector<size_t> & interp_is = interpMatrix.stencils[jloc];
-      const std::vector<double> & interp_ws = interpMatrix.weights[jloc];
+    const std::vector<size_t> & interp_is = interpMatrix.stencils[jloc];
+    const std::vector<double> & interp_ws = interpMatrix.weights[jloc];
 
-      if (interp_type == "default") {
-        for (size_t jj = 0; jj < nstencil_; ++jj) {
-          *gridout += interp_ws[jj] * gridin(interp_is[jj], ilev);
-        }
-      } else if (interp_type == "integer") {
-        // Find which integer value has largest weight in the stencil. We do this by taking two
-        // passes through the (usually short) data: first to identify range of values, then to
-        // determine weights for each integer.
-        // Note that a std::map would be shorter to code, because it would avoid needing to find
-        // the range of possible integer values, but vectors are almost always much more efficient.
-        int minval = std::numeric_limits<int>().max();
-        int maxval = std::numeric_limits<int>().min();
-        for (size_t jj = 0; jj < nstencil_; ++jj) {
-          minval = std::min(minval, static_cast<int>(std::round(gridin(interp_is[jj], ilev))));
-          maxval = std::max(maxval, static_cast<int>(std::round(gridin(interp_is[jj], ilev))));
-        }
-        std::vector<double> int_weights(maxval - minval + 1, 0.0);
-        for (size_t jj = 0; jj < nstencil_; ++jj) {
-          const int this_int = std::round(gridin(interp_is[jj], ilev));
-          int_weights[this_int - minval] += interp_ws[jj];
-        }
-        *gridout = minval + std::distance(int_weights.begin(),
-            std::max_element(int_weights.begin(), int_weights.end()));
-      } else if (interp_type == "nearest") {
-        // Return value from closest unmasked source point
-        for (size_t jj = 0; jj < nstencil_; ++jj) {
-          if (interp_ws[jj] > 1.0e-9) {  // use a small tolerance to allow for roundoff in weights
-            *gridout = gridin(interp_is[jj], ilev);
-            break;
-          }
+    if (interp_type == "default") {
+      for (size_t jj = 0; jj < nstencil_; ++jj) {
+        value += interp_ws[jj] * gridin(interp_is[jj], ilev);
+      }
+    } else if (interp_type == "integer") {
+      // Find which integer value has largest weight in the stencil. We do this by taking two
+      // passes through the (usually short) data: first to identify range of values, then to
+      // determine weights for each integer.
+      // Note that a std::map would be shorter to code, because it would avoid needing to find
+      // the range of possible integer values, but vectors are almost always much more efficient.
+      int minval = std::numeric_limits<int>().max();
+      int maxval = std::numeric_limits<int>().min();
+      for (size_t jj = 0; jj < nstencil_; ++jj) {
+        minval = std::min(minval, static_cast<int>(std::round(gridin(interp_is[jj], ilev))));
+        maxval = std::max(maxval, static_cast<int>(std::round(gridin(interp_is[jj], ilev))));
+      }
+      std::vector<double> int_weights(maxval - minval + 1, 0.0);
+      for (size_t jj = 0; jj < nstencil_; ++jj) {
+        const int this_int = std::round(gridin(interp_is[jj], ilev));
+        int_weights[this_int - minval] += interp_ws[jj];
+      }
+      value = minval + std::distance(int_weights.begin(),
+          std::max_element(int_weights.begin(), int_weights.end()));
+    } else {
+      // "nearest": Return value from closest unmasked source point
+      for (size_t jj = 0; jj < nstencil_; ++jj) {
+        if (interp_ws[jj] > 1.0e-9) {  // use a small tolerance to allow for roundoff in weights
+          value = gridin(interp_is[jj], ilev);
+          break;
         }
-      } else {
-        throw eckit::BadValue("Unknown interpolation type");
       }
     }
-    ++gridout;
   }
+  gridout += nout_;
 }
 
 // -----------------------------------------------------------------------------
@@ -417,36 +431,83 @@ void UnstructuredInterpolator<MODEL>::applyPerLevelAD(
     atlas::array::ArrayView<double, 2> & gridin,
     std::vector<double>::const_iterator & gridout,
     const size_t & ilev) const {
-  for (size_t jloc = 0; jloc < nout_; ++jloc) {
-    if (target_mask[jloc]) {
-      // (Adjoint of) No valid stencil to interpolate to this target => return missingValue
-      if (!interpMatrix.targetHasValidStencil[jloc]) {
-        ++gridout;
-        continue;
+  const auto in = gridout;
+  if (interp_type == "default") {
+    // Loop over source points using the transposed stencils, so threads never write to the same
+    // point. Contributions are summed in the same order as in a loop over target points.
+    const std::vector<size_t> & offsets = interpMatrix.adjOffsets;
+    const std::vector<size_t> & targets = interpMatrix.adjTargets;
+    const std::vector<double> & weights = interpMatrix.adjWeights;
+    ASSERT(!offsets.empty());
+    const size_t nsrc = offsets.size() - 1;
+    ASSERT(nsrc <= static_cast<size_t>(gridin.shape(0)));
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for (size_t jsrc = 0; jsrc < nsrc; ++jsrc) {
+      for (size_t jj = offsets[jsrc]; jj < offsets[jsrc + 1]; ++jj) {
+        if (target_mask[targets[jj]]) gridin(jsrc, ilev) += weights[jj] * in[targets[jj]];
       }
+    }
+  } else if (interp_type == "integer") {
+    throw eckit::BadValue("No adjoint for integer interpolation");
+  } else if (interp_type == "nearest") {
+    for (size_t jloc = 0; jloc < nout_; ++jloc) {
+      // (Adjoint of) No valid stencil to interpolate to this target => return missingValue
+      if (!target_mask[jloc] || !interpMatrix.targetHasValidStencil[jloc]) continue;
 
       const std::vector<size_t> & interp_is = interpMatrix.stencils[jloc];
       const std::vector<double> & interp_ws = interpMatrix.weights[jloc];
-
-      if (interp_type == "default") {
-        for (size_t jj = 0; jj < nstencil_; ++jj) {
-          gridin(interp_is[jj], ilev) += interp_ws[jj] * *gridout;
-        }
-      } else if (interp_type == "integer") {
-        throw eckit::BadValue("No adjoint for integer interpolation");
-      } else if (interp_type == "nearest") {
-        // (Adjoint of) Return value from closest unmasked source point
-        for (size_t jj = 0; jj < nstencil_; ++jj) {
-          if (interp_ws[jj] > 1.0e-9) {  // use a small tolerance to allow for roundoff in weights
-            gridin(interp_is[jj], ilev) += *gridout;
-            break;
-          }
+      // (Adjoint of) Return value from closest unmasked source point
+      for (size_t jj = 0; jj < nstencil_; ++jj) {
+        if (interp_ws[jj] > 1.0e-9) {  // use a small tolerance to allow for roundoff in weights
+          gridin(interp_is[jj], ilev) += in[jloc];
+          break;
         }
-      } else {
-        throw eckit::BadValue("Unknown interpolation type");
       }
     }
-    ++gridout;
+  } else {
+    throw eckit::BadValue("Unknown interpolation type");
+  }
+  gridout += nout_;
+}
+
+// -----------------------------------------------------------------------------
+
+template<typename MODEL>
+void UnstructuredInterpolator<MODEL>::computeAdjointStencils(InterpMatrix & interpMatrix) const {
+  // Source points are those up to the largest index in a valid stencil
+  size_t nsrc = 0;
+  for (size_t jloc = 0; jloc < nout_; ++jloc) {
+    if (!interpMatrix.targetHasValidStencil[jloc]) continue;
+    for (size_t jj = 0; jj < nstencil_; ++jj) {
+      nsrc = std::max(nsrc, interpMatrix.stencils[jloc][jj] + 1);
+    }
+  }
+
+  // Count the valid stencil entries referencing each source point
+  std::vector<size_t> & offsets = interpMatrix.adjOffsets;
+  offsets.assign(nsrc + 1, 0);
+  for (size_t jloc = 0; jloc < nout_; ++jloc) {
+    if (!interpMatrix.targetHasValidStencil[jloc]) continue;
+    for (size_t jj = 0; jj < nstencil_; ++jj) {
+      ++offsets[interpMatrix.stencils[jloc][jj] + 1];
+    }
+  }
+  for (size_t jsrc = 0; jsrc < nsrc; ++jsrc) offsets[jsrc + 1] += offsets[jsrc];
+
+  // Fill in target indices (increasing within each source point) and weights
+  interpMatrix.adjTargets.resize(offsets[nsrc]);
+  interpMatrix.adjWeights.resize(offsets[nsrc]);
+  std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+  for (size_t jloc = 0; jloc < nout_; ++jloc) {
+    if (!interpMatrix.targetHasValidStencil[jloc]) continue;
+    for (size_t jj = 0; jj < nstencil_; ++jj) {
+      const size_t ii = next[interpMatrix.stencils[jloc][jj]]++;
+      interpMatrix.adjTargets[ii] = jloc;
+      interpMatrix.adjWeights[ii] = interpMatrix.weights[jloc][jj];
+    }
   }
 }
 
@@ -542,40 +603,66 @@ void UnstructuredInterpolator<MODEL>::computeUnmaskedInterpMatrix(
         std::vector<std::vector<size_t>>(nout_, std::vector<size_t>(nstencil_)),
         std::vector<std::vector<double>>(nout_, std::vector<double>(nstencil_, 0.0))}));
 
+  InterpMatrix & interpMatrix = interp_matrices_.at(unmaskedName_);
+  // Validity is gathered as char while threaded (std::vector<bool> packs several flags per word)
+  std::vector<char> valid(nout_, 1);
+
+  // Build the triangulation (with its file I/O and logging) before the threaded search
+  if (nout_ > 0) geom_.buildTriangulation();
+
+  // Stencil searches for different target points are independent. Exceptions cannot leave the
+  // threaded loop: the first one is kept and rethrown after it.
+  std::exception_ptr error = nullptr;
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(dynamic, 64)
+#endif
   for (size_t jloc = 0; jloc < nout_; ++jloc) {
-    std::array<int, 3> indices{};
-    std::array<double, 3> baryCoords{};
-    const bool validTriangle = geom_.containingTriangleAndBarycentricCoords(
-        lats_out[jloc], lons_out[jloc], indices, baryCoords);
-
-    // Edge case: target point outside of source grid, can occur for local-area models
-    if (!validTriangle) {
-      interp_matrices_[unmaskedName_].targetHasValidStencil[jloc] = false;
-      continue;
-    }
+    try {
+      std::array<int, 3> indices{};
+      std::array<double, 3> baryCoords{};
+      const bool validTriangle = geom_.containingTriangleAndBarycentricCoords(
+          lats_out[jloc], lons_out[jloc], indices, baryCoords);
+
+      // Edge case: target point outside of source grid, can occur for local-area models
+      if (!validTriangle) {
+        valid[jloc] = 0;
+        continue;
+      }
 
-    // Reorder points from nearest to furthest (barycentric coords from largest to smallest)
-    // This ordering of the coefficients is used in nearest-neighbor interpolations
-    const auto permutation = detail::decreasing_permutation(baryCoords);
-    indices = detail::permute_array(indices, permutation);
-    baryCoords = detail::permute_array(baryCoords, permutation);
+      // Reorder points from nearest to furthest (barycentric coords from largest to smallest)
+      // This ordering of the coefficients is used in nearest-neighbor interpolations
+      const auto permutation = detail::decreasing_permutation(baryCoords);
+      indices = detail::permute_array(indices, permutation);
+      baryCoords = detail::permute_array(baryCoords, permutation);
 
-    // STRIPACK produces unnormalized barycentric coords, so normalize
-    double wsum = 0.0;
-    for (size_t j = 0; j < nstencil_; ++j) {
-      wsum += baryCoords[j];
-    }
-    ASSERT(wsum > 0.0);
-
-    // Store indices and weights into InterpMatrix datastructure
-    std::vector<size_t> & interp_is = interp_matrices_.at(unmaskedName_).stencils[jloc];
-    std::vector<double> & interp_ws = interp_matrices_.at(unmaskedName_).weights[jloc];
-    for (size_t j = 0; j < nstencil_; ++j) {
-      interp_is[j] = indices[j];
-      interp_ws[j] = baryCoords[j] / wsum;
-      ASSERT(interp_ws[j] >= 0.0 && interp_ws[j] <= 1.0);
+      // STRIPACK produces unnormalized barycentric coords, so normalize
+      double wsum = 0.0;
+      for (size_t j = 0; j < nstencil_; ++j) {
+        wsum += baryCoords[j];
+      }
+      ASSERT(wsum > 0.0);
+
+      // Store indices and weights into InterpMatrix datastructure
+      std::vector<size_t> & interp_is = interpMatrix.stencils[jloc];
+      std::vector<double> & interp_ws = interpMatrix.weights[jloc];
+      for (size_t j = 0; j < nstencil_; ++j) {
+        interp_is[j] = indices[j];
+        interp_ws[j] = baryCoords[j] / wsum;
+        ASSERT(interp_ws[j] >= 0.0 && interp_ws[j] <= 1.0);
+      }
+    } catch (...) {
+#ifdef _OPENMP
+      #pragma omp critical(UnstructuredInterpolator_error)
+#endif
+      if (!error) error = std::current_exception();
     }
   }
+  if (error) std::rethrow_exception(error);
+
+  for (size_t jloc = 0; jloc < nout_; ++jloc) {
+    interpMatrix.targetHasValidStencil[jloc] = valid[jloc];
+  }
+  computeAdjointStencils(interpMatrix);
 }
 
 // -----------------------------------------------------------------------------
@@ -619,6 +706,7 @@ void UnstructuredInterpolator<MODEL>::computeMaskedInterpMatrix(
       }
     }
   }
+  computeAdjointStencils(interp_matrices_[maskName]);
 }
 
 // -----------------------------------------------------------------------------
@@ -20,6 +20,7 @@
 #include "oops/base/Variables.h"
 #include "oops/interface/Locations.h"
 #include "oops/interface/ObsSpace.h"
+#include "oops/util/Logger.h"
 #include "oops/util/ObjectCounter.h"
 #include "oops/util/Printable.h"
 #include "oops/util/Timer.h"
@@ -79,10 +80,10 @@ class GeoVaLs : public util::Printable,
 template <typename OBS>
 GeoVaLs<OBS>::GeoVaLs(const Locations_ & locs, const Variables & vars,
                       const std::vector<size_t> & sizes) : gvals_() {
-  Log::trace() << "GeoVaLs<OBS>::GeoVaLs starting" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::GeoVaLs starting" << std::endl;
   util::Timer timer(classname(), "GeoVaLs");
   gvals_.reset(new GeoVaLs_(locs.locations(), vars, sizes));
-  Log::trace() << "GeoVaLs<OBS>::GeoVaLs done" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::GeoVaLs done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
@@ -91,40 +92,40 @@ template <typename OBS>
   GeoVaLs<OBS>::GeoVaLs(const Parameters_ & params,
                         const ObsSpace_ & ospace, const Variables & vars)
   : gvals_() {
-  Log::trace() << "GeoVaLs<OBS>::GeoVaLs read starting" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::GeoVaLs read starting" << std::endl;
   util::Timer timer(classname(), "GeoVaLs");
   gvals_.reset(new GeoVaLs_(params, ospace.obsspace(), vars));
-  Log::trace() << "GeoVaLs<OBS>::GeoVaLs read done" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::GeoVaLs read done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template <typename OBS>
 GeoVaLs<OBS>::GeoVaLs(const GeoVaLs & other): gvals_() {
-  Log::trace() << "GeoVaLs<OBS>::GeoVaLs starting" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::GeoVaLs starting" << std::endl;
   util::Timer timer(classname(), "GeoVaLs");
   gvals_.reset(new GeoVaLs_(*other.gvals_));
-  Log::trace() << "ObsVector<OBS>::GeoVaLs done" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::GeoVaLs done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template <typename OBS>
 GeoVaLs<OBS>::~GeoVaLs() {
-  Log::trace() << "GeoVaLs<OBS>::~GeoVaLs starting" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::~GeoVaLs starting" << std::endl;
   util::Timer timer(classname(), "~GeoVaLs");
   gvals_.reset();
-  Log::trace() << "GeoVaLs<OBS>::~GeoVaLs done" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::~GeoVaLs done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template <typename OBS>
 double GeoVaLs<OBS>::dot_product_with(const GeoVaLs & other) const {
-  Log::trace() << "GeoVaLs<OBS>::dot_product_with starting" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::dot_product_with starting" << std::endl;
   util::Timer timer(classname(), "dot_product_with");
   double zz = gvals_->dot_product_with(*other.gvals_);
-  Log::trace() << "GeoVaLs<OBS>::dot_product_with done" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::dot_product_with done" << std::endl;
   return zz;
 }
 
@@ -132,10 +133,10 @@ double GeoVaLs<OBS>::dot_product_with(const GeoVaLs & other) const {
 
 template <typename OBS>
 GeoVaLs<OBS> & GeoVaLs<OBS>::operator=(const GeoVaLs & rhs) {
-  Log::trace() << "GeoVaLs<OBS>::operator= starting" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::operator= starting" << std::endl;
   util::Timer timer(classname(), "operator=");
   *gvals_ = *rhs.gvals_;
-  Log::trace() << "GeovaLs<OBS>::operator= done" << std::endl;
+  OOPS_LOG_TRACE << "GeovaLs<OBS>::operator= done" << std::endl;
   return *this;
 }
 
@@ -143,10 +144,10 @@ GeoVaLs<OBS> & GeoVaLs<OBS>::operator=(const GeoVaLs & rhs) {
 
 template <typename OBS>
 GeoVaLs<OBS> & GeoVaLs<OBS>::operator+=(const GeoVaLs & rhs) {
-  Log::trace() << "GeoVaLs<OBS>::+=(GeoVaLs, GeoVaLs) starting" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::+=(GeoVaLs, GeoVaLs) starting" << std::endl;
   util::Timer timer(classname(), "operator+=");
   *gvals_ += *rhs.gvals_;
-  Log::trace() << "GeoVaLs<OBS>::+= done" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::+= done" << std::endl;
   return *this;
 }
 
@@ -154,10 +155,10 @@ GeoVaLs<OBS> & GeoVaLs<OBS>::operator+=(const GeoVaLs & rhs) {
 
 template <typename OBS>
 GeoVaLs<OBS> & GeoVaLs<OBS>::operator-=(const GeoVaLs & rhs) {
-  Log::trace() << "GeoVaLs<OBS>::-=(GeoVaLs, GeoVaLs) starting" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::-=(GeoVaLs, GeoVaLs) starting" << std::endl;
   util::Timer timer(classname(), "operator-=");
   *gvals_ -= *rhs.gvals_;
-  Log::trace() << "GeoVaLs<OBS>::-= done" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::-= done" << std::endl;
   return *this;
 }
 
@@ -165,10 +166,10 @@ GeoVaLs<OBS> & GeoVaLs<OBS>::operator-=(const GeoVaLs & rhs) {
 
 template <typename OBS>
 GeoVaLs<OBS> & GeoVaLs<OBS>::operator*=(const GeoVaLs & rhs) {
-  Log::trace() << "GeoVaLs<OBS>::*=(GeoVaLs, GeoVaLs) starting" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::*=(GeoVaLs, GeoVaLs) starting" << std::endl;
   util::Timer timer(classname(), "operator*=(schur)");
   *gvals_ *= *rhs.gvals_;
-  Log::trace() << "GeoVaLs<OBS>::*= done" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::*= done" << std::endl;
   return *this;
 }
 
@@ -176,10 +177,10 @@ GeoVaLs<OBS> & GeoVaLs<OBS>::operator*=(const GeoVaLs & rhs) {
 
 template<typename OBS>
 GeoVaLs<OBS> & GeoVaLs<OBS>::operator*=(const double & zz) {
-  Log::trace() << "GeoVaLs<OBS>::operator*= starting" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::operator*= starting" << std::endl;
   util::Timer timer(classname(), "operator*=");
   *gvals_ *= zz;
-  Log::trace() << "GeoVaLs<OBS>::operator*= done" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::operator*= done" << std::endl;
   return *this;
 }
 
@@ -187,10 +188,10 @@ GeoVaLs<OBS> & GeoVaLs<OBS>::operator*=(const double & zz) {
 
 template <typename OBS>
 double GeoVaLs<OBS>::rms() const {
-  Log::trace() << "GeoVaLs<OBS>::rms starting" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::rms starting" << std::endl;
   util::Timer timer(classname(), "rms");
   double zz = gvals_->rms();
-  Log::trace() << "GeoVaLs<OBS>::rms done" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::rms done" << std::endl;
   return zz;
 }
 
@@ -198,10 +199,10 @@ double GeoVaLs<OBS>::rms() const {
 
 template <typename OBS>
 double GeoVaLs<OBS>::normalizedrms(const GeoVaLs & rhs) const {
-  Log::trace() << "GeoVaLs<OBS>::normalizedrms starting" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::normalizedrms starting" << std::endl;
   util::Timer timer(classname(), "normalizedrms");
   double zz = gvals_->normalizedrms(*rhs.gvals_);
-  Log::trace() << "GeoVaLs<OBS>::normalizedrms done" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::normalizedrms done" << std::endl;
   return zz;
 }
 
@@ -209,20 +210,20 @@ double GeoVaLs<OBS>::normalizedrms(const GeoVaLs & rhs) const {
 
 template <typename OBS>
 void GeoVaLs<OBS>::zero() {
-  Log::trace() << "GeoVaLs<OBS>::zero starting" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::zero starting" << std::endl;
   util::Timer timer(classname(), "zero");
   gvals_->zero();
-  Log::trace() << "GeoVaLs<OBS>::zero done" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::zero done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template <typename OBS>
 void GeoVaLs<OBS>::random() {
-  Log::trace() << "GeoVaLs<OBS>::random starting" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::random starting" << std::endl;
   util::Timer timer(classname(), "random");
   gvals_->random();
-  Log::trace() << "GeoVaLs<OBS>::random done" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::random done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
@@ -230,10 +231,10 @@ void GeoVaLs<OBS>::random() {
 template <typename OBS>
 void GeoVaLs<OBS>::fill(const std::vector<size_t> & indx,
                         const std::vector<double> & vals, const bool levelsTopDown) {
-  Log::trace() << "GeoVaLs<OBS>::fill starting" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::fill starting" << std::endl;
   util::Timer timer(classname(), "fill");
   gvals_->fill(indx, vals, levelsTopDown);
-  Log::trace() << "GeoVaLs<OBS>::fill done" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::fill done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
@@ -241,40 +242,40 @@ void GeoVaLs<OBS>::fill(const std::vector<size_t> & indx,
 template <typename OBS>
 void GeoVaLs<OBS>::fillAD(const std::vector<size_t> & indx,
                           std::vector<double> & vals, const bool levelsTopDown) const {
-  Log::trace() << "GeoVaLs<OBS>::fillAD starting" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::fillAD starting" << std::endl;
   util::Timer timer(classname(), "fillAD");
   gvals_->fillAD(indx, vals, levelsTopDown);
-  Log::trace() << "GeoVaLs<OBS>::fillAD done" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::fillAD done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename OBS>
 void GeoVaLs<OBS>::read(const Parameters_ & params) {
-  Log::trace() << "GeoVaLs<OBS>::read starting" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::read starting" << std::endl;
   util::Timer timer(classname(), "read");
   gvals_->read(params);
-  Log::trace() << "GeoVaLs<OBS>::read done" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::read done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename OBS>
 void GeoVaLs<OBS>::write(const Parameters_ & params) const {
-  Log::trace() << "GeoVaLs<OBS>::write starting" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::write starting" << std::endl;
   util::Timer timer(classname(), "write");
   gvals_->write(params);
-  Log::trace() << "GeoVaLs<OBS>::write done" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::write done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename OBS>
 void GeoVaLs<OBS>::print(std::ostream & os) const {
-  Log::trace() << "GeoVaLs<OBS>::print starting" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::print starting" << std::endl;
   util::Timer timer(classname(), "print");
   os << *gvals_;
-  Log::trace() << "GeoVaLs<OBS>::print done" << std::endl;
+  OOPS_LOG_TRACE << "GeoVaLs<OBS>::print done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
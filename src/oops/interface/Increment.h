@@ -27,6 +27,7 @@
 #include "oops/interface/GeometryIterator.h"
 #include "oops/util/DateTime.h"
 #include "oops/util/Duration.h"
+#include "oops/util/Logger.h"
 #include "oops/util/ObjectCounter.h"
 #include "oops/util/parameters/GenericParameters.h"
 #include "oops/util/parameters/HasDiracParameters_.h"
@@ -200,11 +201,11 @@ Increment<MODEL>::Increment(const Geometry_ & resol, const Variables & vars,
                             const util::DateTime & time)
   : increment_(), fset_()
 {
-  Log::trace() << "Increment<MODEL>::Increment starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::Increment starting" << std::endl;
   util::Timer timer(classname(), "Increment");
   increment_.reset(new Increment_(resol.geometry(), vars, time));
   this->setObjectSize(increment_->serialSize()*sizeof(double));
-  Log::trace() << "Increment<MODEL>::Increment done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::Increment done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
@@ -213,11 +214,11 @@ template<typename MODEL>
 Increment<MODEL>::Increment(const Geometry_ & resol, const Increment & other)
   : increment_(), fset_()
 {
-  Log::trace() << "Increment<MODEL>::Increment chres starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::Increment chres starting" << std::endl;
   util::Timer timer(classname(), "Increment");
   increment_.reset(new Increment_(resol.geometry(), *other.increment_));
   this->setObjectSize(increment_->serialSize()*sizeof(double));
-  Log::trace() << "Increment<MODEL>::Increment chres done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::Increment chres done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
@@ -226,77 +227,77 @@ template<typename MODEL>
 Increment<MODEL>::Increment(const Increment & other, const bool copy)
   : increment_(), fset_()
 {
-  Log::trace() << "Increment<MODEL>::Increment copy starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::Increment copy starting" << std::endl;
   util::Timer timer(classname(), "Increment");
   increment_.reset(new Increment_(*other.increment_, copy));
   this->setObjectSize(increment_->serialSize()*sizeof(double));
-  Log::trace() << "Increment<MODEL>::Increment copy done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::Increment copy done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
 Increment<MODEL>::~Increment() {
-  Log::trace() << "Increment<MODEL>::~Increment starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::~Increment starting" << std::endl;
   util::Timer timer(classname(), "~Increment");
   increment_.reset();
   fset_.clear();
-  Log::trace() << "Increment<MODEL>::~Increment done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::~Increment done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
 void Increment<MODEL>::diff(const State_ & x1, const State_ & x2) {
-  Log::trace() << "Increment<MODEL>::diff starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::diff starting" << std::endl;
   util::Timer timer(classname(), "diff");
   fset_.clear();
   increment_->diff(x1.state(), x2.state());
-  Log::trace() << "Increment<MODEL>::diff done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::diff done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
 void Increment<MODEL>::zero() {
-  Log::trace() << "Increment<MODEL>::zero starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::zero starting" << std::endl;
   util::Timer timer(classname(), "zero");
   fset_.clear();
   increment_->zero();
-  Log::trace() << "Increment<MODEL>::zero done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::zero done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
 void Increment<MODEL>::zero(const util::DateTime & tt) {
-  Log::trace() << "Increment<MODEL>::zero starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::zero starting" << std::endl;
   util::Timer timer(classname(), "zero");
   fset_.clear();
   increment_->zero(tt);
-  Log::trace() << "Increment<MODEL>::zero done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::zero done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
 void Increment<MODEL>::ones() {
-  Log::trace() << "Increment<MODEL>::ones starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::ones starting" << std::endl;
   util::Timer timer(classname(), "ones");
   fset_.clear();
   increment_->ones();
-  Log::trace() << "Increment<MODEL>::ones done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::ones done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
 void Increment<MODEL>::dirac(const DiracParameters_ & parameters) {
-  Log::trace() << "Increment<MODEL>::dirac starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::dirac starting" << std::endl;
   util::Timer timer(classname(), "dirac");
   fset_.clear();
   increment_->dirac(parametersOrConfiguration<HasDiracParameters_<Increment_>::value>(parameters));
-  Log::trace() << "Increment<MODEL>::dirac done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::dirac done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
@@ -312,11 +313,11 @@ void Increment<MODEL>::dirac(const eckit::Configuration & config) {
 
 template<typename MODEL>
 Increment<MODEL> & Increment<MODEL>::operator=(const Increment & rhs) {
-  Log::trace() << "Increment<MODEL>::operator= starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::operator= starting" << std::endl;
   util::Timer timer(classname(), "operator=");
   fset_.clear();
   *increment_ = *rhs.increment_;
-  Log::trace() << "Increment<MODEL>::operator= done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::operator= done" << std::endl;
   return *this;
 }
 
@@ -324,11 +325,11 @@ Increment<MODEL> & Increment<MODEL>::operator=(const Increment & rhs) {
 
 template<typename MODEL>
 Increment<MODEL> & Increment<MODEL>::operator+=(const Increment & rhs) {
-  Log::trace() << "Increment<MODEL>::operator+= starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::operator+= starting" << std::endl;
   util::Timer timer(classname(), "operator+=");
   fset_.clear();
   *increment_ += *rhs.increment_;
-  Log::trace() << "Increment<MODEL>::operator+= done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::operator+= done" << std::endl;
   return *this;
 }
 
@@ -336,11 +337,11 @@ Increment<MODEL> & Increment<MODEL>::operator+=(const Increment & rhs) {
 
 template<typename MODEL>
 Increment<MODEL> & Increment<MODEL>::operator-=(const Increment & rhs) {
-  Log::trace() << "Increment<MODEL>::operator-= starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::operator-= starting" << std::endl;
   util::Timer timer(classname(), "operator-=");
   fset_.clear();
   *increment_ -= *rhs.increment_;
-  Log::trace() << "Increment<MODEL>::operator-= done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::operator-= done" << std::endl;
   return *this;
 }
 
@@ -348,11 +349,11 @@ Increment<MODEL> & Increment<MODEL>::operator-=(const Increment & rhs) {
 
 template<typename MODEL>
 Increment<MODEL> & Increment<MODEL>::operator*=(const double & zz) {
-  Log::trace() << "Increment<MODEL>::operator*= starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::operator*= starting" << std::endl;
   util::Timer timer(classname(), "operator*=");
   fset_.clear();
   *increment_ *= zz;
-  Log::trace() << "Increment<MODEL>::operator*= done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::operator*= done" << std::endl;
   return *this;
 }
 
@@ -360,21 +361,21 @@ Increment<MODEL> & Increment<MODEL>::operator*=(const double & zz) {
 
 template<typename MODEL>
 void Increment<MODEL>::axpy(const double & zz, const Increment & dx, const bool check) {
-  Log::trace() << "Increment<MODEL>::axpy starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::axpy starting" << std::endl;
   util::Timer timer(classname(), "axpy");
   fset_.clear();
   increment_->axpy(zz, *dx.increment_, check);
-  Log::trace() << "Increment<MODEL>::axpy done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::axpy done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
 double Increment<MODEL>::dot_product_with(const Increment & dx) const {
-  Log::trace() << "Increment<MODEL>::dot_product_with starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::dot_product_with starting" << std::endl;
   util::Timer timer(classname(), "dot_product_with");
   double zz = increment_->dot_product_with(*dx.increment_);
-  Log::trace() << "Increment<MODEL>::dot_product_with done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::dot_product_with done" << std::endl;
   return zz;
 }
 
@@ -382,43 +383,43 @@ double Increment<MODEL>::dot_product_with(const Increment & dx) const {
 
 template<typename MODEL>
 void Increment<MODEL>::schur_product_with(const Increment & dx) {
-  Log::trace() << "Increment<MODEL>::schur_product_with starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::schur_product_with starting" << std::endl;
   util::Timer timer(classname(), "schur_product_with");
   fset_.clear();
   increment_->schur_product_with(*dx.increment_);
-  Log::trace() << "Increment<MODEL>::schur_product_with done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::schur_product_with done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
 void Increment<MODEL>::random() {
-  Log::trace() << "Increment<MODEL>::random starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::random starting" << std::endl;
   util::Timer timer(classname(), "random");
   fset_.clear();
   increment_->random();
-  Log::trace() << "Increment<MODEL>::random done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::random done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
 void Increment<MODEL>::accumul(const double & zz, const State_ & xx) {
-  Log::trace() << "Increment<MODEL>::accumul starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::accumul starting" << std::endl;
   util::Timer timer(classname(), "accumul");
   fset_.clear();
   increment_->accumul(zz, xx.state());
-  Log::trace() << "Increment<MODEL>::accumul done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::accumul done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
 LocalIncrement Increment<MODEL>::getLocal(const GeometryIterator_ & iter) const {
-  Log::trace() << "Increment<MODEL>::getLocal starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::getLocal starting" << std::endl;
   util::Timer timer(classname(), "getLocal");
   LocalIncrement gp = increment_->getLocal(iter.geometryiter());
-  Log::trace() << "Increment<MODEL>::getLocal done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::getLocal done" << std::endl;
   return gp;
 }
 
@@ -426,22 +427,22 @@ LocalIncrement Increment<MODEL>::getLocal(const GeometryIterator_ & iter) const
 template<typename MODEL>
 void Increment<MODEL>::setLocal(const LocalIncrement & gp,
                                 const GeometryIterator_ & iter) {
-  Log::trace() << "Increment<MODEL>::setLocal starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::setLocal starting" << std::endl;
   util::Timer timer(classname(), "setLocal");
   fset_.clear();
   increment_->setLocal(gp, iter.geometryiter());
-  Log::trace() << "Increment<MODEL>::setLocal done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::setLocal done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
 void Increment<MODEL>::read(const ReadParameters_ & parameters) {
-  Log::trace() << "Increment<MODEL>::read starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::read starting" << std::endl;
   util::Timer timer(classname(), "read");
   fset_.clear();
   increment_->read(parametersOrConfiguration<HasReadParameters_<Increment_>::value>(parameters));
-  Log::trace() << "Increment<MODEL>::read done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::read done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
@@ -457,10 +458,10 @@ void Increment<MODEL>::read(const eckit::Configuration & config) {
 
 template<typename MODEL>
 void Increment<MODEL>::write(const WriteParameters_ & parameters) const {
-  Log::trace() << "Increment<MODEL>::write starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::write starting" << std::endl;
   util::Timer timer(classname(), "write");
   increment_->write(parametersOrConfiguration<HasWriteParameters_<Increment_>::value>(parameters));
-  Log::trace() << "Increment<MODEL>::write done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::write done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
@@ -476,10 +477,10 @@ void Increment<MODEL>::write(const eckit::Configuration & config) const {
 
 template<typename MODEL>
 double Increment<MODEL>::norm() const {
-  Log::trace() << "Increment<MODEL>::norm starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::norm starting" << std::endl;
   util::Timer timer(classname(), "norm");
   double zz = increment_->norm();
-  Log::trace() << "Increment<MODEL>::norm done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::norm done" << std::endl;
   return zz;
 }
 
@@ -487,10 +488,10 @@ double Increment<MODEL>::norm() const {
 
 template<typename MODEL>
 std::vector<double> Increment<MODEL>::rmsByLevel(const std::string & var) const {
-  Log::trace() << "Increment<MODEL>::rmsByLevel starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::rmsByLevel starting" << std::endl;
   util::Timer timer(classname(), "rmsByLevel");
   std::vector<double> rms = increment_->rmsByLevel(var);
-  Log::trace() << "Increment<MODEL>::rmsByLevel done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::rmsByLevel done" << std::endl;
   return rms;
 }
 
@@ -498,38 +499,38 @@ std::vector<double> Increment<MODEL>::rmsByLevel(const std::string & var) const
 
 template<typename MODEL>
 void Increment<MODEL>::toFieldSet(atlas::FieldSet & fset) const {
-  Log::trace() << "Increment<MODEL>::toFieldSet starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::toFieldSet starting" << std::endl;
   util::Timer timer(classname(), "toFieldSet");
   increment_->toFieldSet(fset);
-  Log::trace() << "Increment<MODEL>::toFieldSet done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::toFieldSet done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
 void Increment<MODEL>::toFieldSetAD(const atlas::FieldSet & fset) {
-  Log::trace() << "Increment<MODEL>::toFieldSetAD starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::toFieldSetAD starting" << std::endl;
   util::Timer timer(classname(), "toFieldSetAD");
   increment_->toFieldSetAD(fset);
-  Log::trace() << "Increment<MODEL>::toFieldSetAD done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::toFieldSetAD done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
 void Increment<MODEL>::fromFieldSet(const atlas::FieldSet & fset) {
-  Log::trace() << "Increment<MODEL>::fromFieldSet starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::fromFieldSet starting" << std::endl;
   util::Timer timer(classname(), "fromFieldSet");
   increment_->fromFieldSet(fset);
   fset_.clear();
-  Log::trace() << "Increment<MODEL>::fromFieldSet done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::fromFieldSet done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
 size_t Increment<MODEL>::serialSize() const {
-  Log::trace() << "Increment<MODEL>::serialSize" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::serialSize" << std::endl;
   util::Timer timer(classname(), "serialSize");
   return increment_->serialSize();
 }
@@ -538,31 +539,31 @@ size_t Increment<MODEL>::serialSize() const {
 
 template<typename MODEL>
 void Increment<MODEL>::serialize(std::vector<double> & vect) const {
-  Log::trace() << "Increment<MODEL>::serialize starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::serialize starting" << std::endl;
   util::Timer timer(classname(), "serialize");
   increment_->serialize(vect);
-  Log::trace() << "Increment<MODEL>::serialize done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::serialize done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
 void Increment<MODEL>::deserialize(const std::vector<double> & vect, size_t & current) {
-  Log::trace() << "Increment<MODEL>::Increment deserialize starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::Increment deserialize starting" << std::endl;
   util::Timer timer(classname(), "deserialize");
   fset_.clear();
   increment_->deserialize(vect, current);
-  Log::trace() << "Increment<MODEL>::Increment deserialize done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::Increment deserialize done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
 void Increment<MODEL>::print(std::ostream & os) const {
-  Log::trace() << "Increment<MODEL>::print starting" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::print starting" << std::endl;
   util::Timer timer(classname(), "print");
   os << *increment_;
-  Log::trace() << "Increment<MODEL>::print done" << std::endl;
+  OOPS_LOG_TRACE << "Increment<MODEL>::print done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
@@ -16,6 +16,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "oops/base/Geometry.h"
 #include "oops/base/Increment.h"
@@ -56,11 +57,20 @@ class LocalizationBase : public oops::LocalizationBase<MODEL> {
        { this->randomize(dx.increment()); }
   void multiply(oops::Increment<MODEL> & dx) const final
        { this->multiply(dx.increment()); }
+  void multiplyEnsemble(std::vector<oops::Increment<MODEL>> & dxs) const final {
+    std::vector<Increment_ *> members;
+    members.reserve(dxs.size());
+    for (oops::Increment<MODEL> & dx : dxs) members.push_back(&dx.increment());
+    this->multiplyEnsemble(members);
+  }
 
   /// Randomize \p dx and apply 3D localization
   virtual void randomize(Increment_ & dx) const = 0;
   /// Apply 3D localization to \p dx
   virtual void multiply(Increment_ & dx) const = 0;
+  /// Apply 3D localization to all increments in \p dxs (default: one at a time)
+  virtual void multiplyEnsemble(const std::vector<Increment_ *> & dxs) const
+       { for (Increment_ * dx : dxs) this->multiply(*dx); }
 };
 
 // -----------------------------------------------------------------------------
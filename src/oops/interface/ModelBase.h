@@ -10,6 +10,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <boost/make_unique.hpp>
 
@@ -63,6 +64,12 @@ class ModelBase : public oops::ModelBase<MODEL> {
        { this->step(xx.state(), modelaux.modelauxcontrol()); }
   void finalize(oops::State<MODEL> & xx) const final
        { this->finalize(xx.state()); }
+  void stepEnsemble(std::vector<oops::State<MODEL> *> & xx,
+                    const ModelAuxControl<MODEL> & modelaux) const final {
+    std::vector<State_ *> members;
+    for (oops::State<MODEL> * jx : xx) members.push_back(&jx->state());
+    this->stepEnsemble(members, modelaux.modelauxcontrol());
+  }
 
   /// \brief Forecast initialization, called before every forecast run
   virtual void initialize(State_ &) const = 0;
@@ -70,6 +77,11 @@ class ModelBase : public oops::ModelBase<MODEL> {
   virtual void step(State_ &, const ModelAux_ &) const = 0;
   /// \brief Forecast finalization; called after each forecast run
   virtual void finalize(State_ &) const = 0;
+  /// \brief Steps all members of an ensemble valid at the same time. Models that can
+  /// advance several members together should override it along with hasBatchedStep().
+  virtual void stepEnsemble(std::vector<State_ *> & xx, const ModelAux_ & maux) const {
+    for (State_ * jx : xx) this->step(*jx, maux);
+  }
 };
 
 // -----------------------------------------------------------------------------
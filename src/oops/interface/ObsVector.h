@@ -110,191 +110,191 @@ class ObsVector : public util::Printable,
 // -----------------------------------------------------------------------------
 template <typename OBS>
 ObsVector<OBS>::ObsVector(const ObsSpace<OBS> & os, const std::string name) : data_() {
-  Log::trace() << "ObsVector<OBS>::ObsVector starting " << name << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::ObsVector starting " << name << std::endl;
   util::Timer timer(classname(), "ObsVector");
   data_.reset(new ObsVector_(os.obsspace(), name));
   this->setObjectSize(data_->size() * sizeof(double));
-  Log::trace() << "ObsVector<OBS>::ObsVector done" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::ObsVector done" << std::endl;
 }
 // -----------------------------------------------------------------------------
 template <typename OBS>
 ObsVector<OBS>::ObsVector(std::unique_ptr<ObsVector_> obsvector)
   : data_(std::move(obsvector)) {
-  Log::trace() << "ObsVector<OBS>::ObsVector starting " << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::ObsVector starting " << std::endl;
   util::Timer timer(classname(), "ObsVector");
   this->setObjectSize(data_->size() * sizeof(double));
-  Log::trace() << "ObsVector<OBS>::ObsVector done" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::ObsVector done" << std::endl;
 }
 // -----------------------------------------------------------------------------
 template <typename OBS>
 ObsVector<OBS>::ObsVector(const ObsVector & other): data_() {
-  Log::trace() << "ObsVector<OBS>::ObsVector starting" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::ObsVector starting" << std::endl;
   util::Timer timer(classname(), "ObsVector");
   data_.reset(new ObsVector_(*other.data_));
   this->setObjectSize(data_->size() * sizeof(double));
-  Log::trace() << "ObsVector<OBS>::ObsVector done" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::ObsVector done" << std::endl;
 }
 // -----------------------------------------------------------------------------
 template <typename OBS>
 ObsVector<OBS>::~ObsVector() {
-  Log::trace() << "ObsVector<OBS>::~ObsVector starting" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::~ObsVector starting" << std::endl;
   util::Timer timer(classname(), "~ObsVector");
   data_.reset();
-  Log::trace() << "ObsVector<OBS>::~ObsVector done" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::~ObsVector done" << std::endl;
 }
 // -----------------------------------------------------------------------------
 template <typename OBS>
 ObsVector<OBS> & ObsVector<OBS>::operator=(const ObsVector & rhs) {
-  Log::trace() << "ObsVector<OBS>::operator= starting" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::operator= starting" << std::endl;
   util::Timer timer(classname(), "operator=");
 
   *data_ = *rhs.data_;
 
-  Log::trace() << "ObsVector<OBS>::operator= done" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::operator= done" << std::endl;
   return *this;
 }
 // -----------------------------------------------------------------------------
 template <typename OBS>
 ObsVector<OBS> & ObsVector<OBS>::operator*=(const double & zz) {
-  Log::trace() << "ObsVector<OBS>::operator*= starting" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::operator*= starting" << std::endl;
   util::Timer timer(classname(), "operator*=");
 
   *data_ *= zz;
 
-  Log::trace() << "ObsVector<OBS>::operator*= done" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::operator*= done" << std::endl;
   return *this;
 }
 // -----------------------------------------------------------------------------
 template <typename OBS>
 ObsVector<OBS> & ObsVector<OBS>::operator+=(const ObsVector & rhs) {
-  Log::trace() << "ObsVector<OBS>::operator+= starting" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::operator+= starting" << std::endl;
   util::Timer timer(classname(), "operator+=");
 
   *data_ += *rhs.data_;
 
-  Log::trace() << "ObsVector<OBS>::operator+= done" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::operator+= done" << std::endl;
   return *this;
 }
 // -----------------------------------------------------------------------------
 template <typename OBS>
 ObsVector<OBS> & ObsVector<OBS>::operator-=(const ObsVector & rhs) {
-  Log::trace() << "ObsVector<OBS>::operator-= starting" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::operator-= starting" << std::endl;
   util::Timer timer(classname(), "operator-=");
 
   *data_ -= *rhs.data_;
 
-  Log::trace() << "ObsVector<OBS>::operator-= done" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::operator-= done" << std::endl;
   return *this;
 }
 // -----------------------------------------------------------------------------
 template <typename OBS>
 ObsVector<OBS> & ObsVector<OBS>::operator*=(const ObsVector & rhs) {
-  Log::trace() << "ObsVector<OBS>::operator*= starting" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::operator*= starting" << std::endl;
   util::Timer timer(classname(), "operator*=");
 
   *data_ *= *rhs.data_;
 
-  Log::trace() << "ObsVector<OBS>::operator*= done" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::operator*= done" << std::endl;
   return *this;
 }
 // -----------------------------------------------------------------------------
 template <typename OBS>
 ObsVector<OBS> & ObsVector<OBS>::operator/=(const ObsVector & rhs) {
-  Log::trace() << "ObsVector<OBS>::operator/= starting" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::operator/= starting" << std::endl;
   util::Timer timer(classname(), "operator/=");
 
   *data_ /= *rhs.data_;
 
-  Log::trace() << "ObsVector<OBS>::operator/= done" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::operator/= done" << std::endl;
   return *this;
 }
 // -----------------------------------------------------------------------------
 template <typename OBS>
 void ObsVector<OBS>::zero() {
-  Log::trace() << "ObsVector<OBS>::zero starting" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::zero starting" << std::endl;
   util::Timer timer(classname(), "zero");
 
   data_->zero();
 
-  Log::trace() << "ObsVector<OBS>::zero done" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::zero done" << std::endl;
 }
 // -----------------------------------------------------------------------------
 template <typename OBS>
 void ObsVector<OBS>::ones() {
-  Log::trace() << "ObsVector<OBS>::ones starting" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::ones starting" << std::endl;
   util::Timer timer(classname(), "ones");
 
   data_->ones();
 
-  Log::trace() << "ObsVector<OBS>::ones done" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::ones done" << std::endl;
 }
 // -----------------------------------------------------------------------------
 template <typename OBS>
 void ObsVector<OBS>::axpy(const double & zz, const ObsVector & rhs) {
-  Log::trace() << "ObsVector<OBS>::axpy starting" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::axpy starting" << std::endl;
   util::Timer timer(classname(), "axpy");
 
   data_->axpy(zz, *rhs.data_);
 
-  Log::trace() << "ObsVector<OBS>::axpy done" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::axpy done" << std::endl;
 }
 // -----------------------------------------------------------------------------
 template <typename OBS>
 void ObsVector<OBS>::invert() {
-  Log::trace() << "ObsVector<OBS>::invert starting" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::invert starting" << std::endl;
   util::Timer timer(classname(), "invert");
 
   data_->invert();
 
-  Log::trace() << "ObsVector<OBS>::invert done" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::invert done" << std::endl;
 }
 // -----------------------------------------------------------------------------
 template <typename OBS>
 void ObsVector<OBS>::random() {
-  Log::trace() << "ObsVector<OBS>::random starting" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::random starting" << std::endl;
   util::Timer timer(classname(), "random");
 
   data_->random();
 
-  Log::trace() << "ObsVector<OBS>::random done" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::random done" << std::endl;
 }
 // -----------------------------------------------------------------------------
 template <typename OBS>
 double ObsVector<OBS>::dot_product_with(const ObsVector & other) const {
-  Log::trace() << "ObsVector<OBS>::dot_product starting" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::dot_product starting" << std::endl;
   util::Timer timer(classname(), "dot_product");
 
   double zz = data_->dot_product_with(*other.data_);
 
-  Log::trace() << "ObsVector<OBS>::dot_product done" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::dot_product done" << std::endl;
   return zz;
 }
 // -----------------------------------------------------------------------------
 template <typename OBS>
 void ObsVector<OBS>::mask(const ObsVector & mask) {
-  Log::trace() << "ObsVector<OBS>::mask(ObsVector) starting" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::mask(ObsVector) starting" << std::endl;
   util::Timer timer(classname(), "mask(ObsVector)");
   data_->mask(mask.obsvector());
-  Log::trace() << "ObsVector<OBS>::mask(ObsVector) done" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::mask(ObsVector) done" << std::endl;
 }
 // -----------------------------------------------------------------------------
 template <typename OBS>
 ObsVector<OBS> & ObsVector<OBS>::operator=(const ObsDataVector<OBS, float> & rhs) {
-  Log::trace() << "ObsVector<OBS>::operator= starting" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::operator= starting" << std::endl;
   util::Timer timer(classname(), "operator=");
   *data_ = rhs.obsdatavector();
-  Log::trace() << "ObsVector<OBS>::operator= done" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::operator= done" << std::endl;
   return *this;
 }
 // -----------------------------------------------------------------------------
 template <typename OBS>
 double ObsVector<OBS>::rms() const {
-  Log::trace() << "ObsVector<OBS>::rms starting" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::rms starting" << std::endl;
   util::Timer timer(classname(), "rms");
 
   double zz = data_->rms();
 
-  Log::trace() << "ObsVector<OBS>::rms done" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::rms done" << std::endl;
   return zz;
 }
 // -----------------------------------------------------------------------------
@@ -306,52 +306,52 @@ unsigned int ObsVector<OBS>::nobs() const {
 // -----------------------------------------------------------------------------
 template <typename OBS>
 void ObsVector<OBS>::print(std::ostream & os) const {
-  Log::trace() << "ObsVector<OBS>::print starting" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::print starting" << std::endl;
   util::Timer timer(classname(), "print");
   os << *data_;
-  Log::trace() << "ObsVector<OBS>::print done" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::print done" << std::endl;
 }
 // -----------------------------------------------------------------------------
 template <typename OBS>
 void ObsVector<OBS>::save(const std::string & name) const {
-  Log::trace() << "ObsVector<OBS>::save starting " << name << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::save starting " << name << std::endl;
   util::Timer timer(classname(), "save");
 
   data_->save(name);
 
-  Log::trace() << "ObsVector<OBS>::save done" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::save done" << std::endl;
 }
 // -----------------------------------------------------------------------------
 template <typename OBS>
 Eigen::VectorXd  ObsVector<OBS>::packEigen(const ObsVector & mask) const {
-  Log::trace() << "ObsVector<OBS>::packEigen starting " << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::packEigen starting " << std::endl;
   util::Timer timer(classname(), "packEigen");
 
   Eigen::VectorXd vec = data_->packEigen(mask.obsvector());
 
-  Log::trace() << "ObsVector<OBS>::packEigen done" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::packEigen done" << std::endl;
   return vec;
 }
 // -----------------------------------------------------------------------------
 template <typename OBS>
 size_t ObsVector<OBS>::packEigenSize(const ObsVector & mask) const {
-  Log::trace() << "ObsVector<OBS>::packEigenSize starting " << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::packEigenSize starting " << std::endl;
   util::Timer timer(classname(), "packEigenSize");
 
   size_t len = data_->packEigenSize(mask.obsvector());
 
-  Log::trace() << "ObsVector<OBS>::packEigen done" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::packEigen done" << std::endl;
   return len;
 }
 // -----------------------------------------------------------------------------
 template <typename OBS>
 void ObsVector<OBS>::read(const std::string & name) {
-  Log::trace() << "ObsVector<OBS>::read starting " << name << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::read starting " << name << std::endl;
   util::Timer timer(classname(), "read");
 
   data_->read(name);
 
-  Log::trace() << "ObsVector<OBS>::read done" << std::endl;
+  OOPS_LOG_TRACE << "ObsVector<OBS>::read done" << std::endl;
 }
 // -----------------------------------------------------------------------------
 
@@ -20,6 +20,7 @@
 #include "oops/base/Geometry.h"
 #include "oops/base/Variables.h"
 #include "oops/util/DateTime.h"
+#include "oops/util/Logger.h"
 #include "oops/util/ObjectCounter.h"
 #include "oops/util/parameters/GenericParameters.h"
 #include "oops/util/parameters/HasParameters_.h"
@@ -155,11 +156,11 @@ template<typename MODEL>
 State<MODEL>::State(const Geometry_ & resol, const Variables & vars,
                     const util::DateTime & time) : state_(), fset_()
 {
-  Log::trace() << "State<MODEL>::State starting" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::State starting" << std::endl;
   util::Timer timer(classname(), "State");
   state_.reset(new State_(resol.geometry(), vars, time));
   this->setObjectSize(state_->serialSize()*sizeof(double));
-  Log::trace() << "State<MODEL>::State done" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::State done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
@@ -168,14 +169,14 @@ template<typename MODEL>
 State<MODEL>::State(const Geometry_ & resol,
                     const Parameters_ & params) : state_(), fset_()
 {
-  Log::trace() << "State<MODEL>::State read starting" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::State read starting" << std::endl;
   util::Timer timer(classname(), "State");
 
   state_.reset(new State_(
                  resol.geometry(),
                  parametersOrConfiguration<HasParameters_<State_>::value>(params)));
   this->setObjectSize(state_->serialSize()*sizeof(double));
-  Log::trace() << "State<MODEL>::State read done" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::State read done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
@@ -184,11 +185,11 @@ template<typename MODEL>
 State<MODEL>::State(const Geometry_ & resol, const State & other)
   : state_(), fset_()
 {
-  Log::trace() << "State<MODEL>::State interpolated starting" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::State interpolated starting" << std::endl;
   util::Timer timer(classname(), "State");
   state_.reset(new State_(resol.geometry(), *other.state_));
   this->setObjectSize(state_->serialSize()*sizeof(double));
-  Log::trace() << "State<MODEL>::State interpolated done" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::State interpolated done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
@@ -196,33 +197,33 @@ State<MODEL>::State(const Geometry_ & resol, const State & other)
 template<typename MODEL>
 State<MODEL>::State(const State & other) : state_(), fset_()
 {
-  Log::trace() << "State<MODEL>::State starting copy" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::State starting copy" << std::endl;
   util::Timer timer(classname(), "State");
   state_.reset(new State_(*other.state_));
   this->setObjectSize(state_->serialSize()*sizeof(double));
-  Log::trace() << "State<MODEL>::State copy done" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::State copy done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
 State<MODEL>::~State() {
-  Log::trace() << "State<MODEL>::~State starting" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::~State starting" << std::endl;
   util::Timer timer(classname(), "~State");
   fset_.clear();
   state_.reset();
-  Log::trace() << "State<MODEL>::~State done" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::~State done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
 State<MODEL> & State<MODEL>::operator=(const State & rhs) {
-  Log::trace() << "State<MODEL>::operator= starting" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::operator= starting" << std::endl;
   util::Timer timer(classname(), "operator=");
   fset_.clear();
   *state_ = *rhs.state_;
-  Log::trace() << "State<MODEL>::operator= done" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::operator= done" << std::endl;
   return *this;
 }
 
@@ -230,11 +231,11 @@ State<MODEL> & State<MODEL>::operator=(const State & rhs) {
 
 template<typename MODEL>
 void State<MODEL>::read(const Parameters_ & parameters) {
-  Log::trace() << "State<MODEL>::read starting" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::read starting" << std::endl;
   util::Timer timer(classname(), "read");
   fset_.clear();
   state_->read(parametersOrConfiguration<HasParameters_<State_>::value>(parameters));
-  Log::trace() << "State<MODEL>::read done" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::read done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
@@ -255,10 +256,10 @@ void State<MODEL>::read(const eckit::Configuration & conf) {
 
 template<typename MODEL>
 void State<MODEL>::write(const WriteParameters_ & parameters) const {
-  Log::trace() << "State<MODEL>::write starting" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::write starting" << std::endl;
   util::Timer timer(classname(), "write");
   state_->write(parametersOrConfiguration<HasWriteParameters_<State_>::value>(parameters));
-  Log::trace() << "State<MODEL>::write done" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::write done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
@@ -279,10 +280,10 @@ void State<MODEL>::write(const eckit::Configuration & conf) const {
 
 template<typename MODEL>
 double State<MODEL>::norm() const {
-  Log::trace() << "State<MODEL>::norm starting" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::norm starting" << std::endl;
   util::Timer timer(classname(), "norm");
   double zz = state_->norm();
-  Log::trace() << "State<MODEL>::norm done" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::norm done" << std::endl;
   return zz;
 }
 
@@ -290,7 +291,7 @@ double State<MODEL>::norm() const {
 
 template<typename MODEL>
 const Variables & State<MODEL>::variables() const {
-  Log::trace() << "State<MODEL>::variables starting" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::variables starting" << std::endl;
   util::Timer timer(classname(), "variables");
   return state_->variables();
 }
@@ -299,7 +300,7 @@ const Variables & State<MODEL>::variables() const {
 
 template<typename MODEL>
 size_t State<MODEL>::serialSize() const {
-  Log::trace() << "State<MODEL>::serialSize" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::serialSize" << std::endl;
   util::Timer timer(classname(), "serialSize");
   return state_->serialSize();
 }
@@ -308,63 +309,63 @@ size_t State<MODEL>::serialSize() const {
 
 template<typename MODEL>
 void State<MODEL>::serialize(std::vector<double> & vect) const {
-  Log::trace() << "State<MODEL>::serialize starting" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::serialize starting" << std::endl;
   util::Timer timer(classname(), "serialize");
   state_->serialize(vect);
-  Log::trace() << "State<MODEL>::serialize done" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::serialize done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
 void State<MODEL>::deserialize(const std::vector<double> & vect, size_t & current) {
-  Log::trace() << "State<MODEL>::State deserialize starting" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::State deserialize starting" << std::endl;
   util::Timer timer(classname(), "deserialize");
   fset_.clear();
   state_->deserialize(vect, current);
-  Log::trace() << "State<MODEL>::State deserialize done" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::State deserialize done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
 void State<MODEL>::toFieldSet(atlas::FieldSet & fset) const {
-  Log::trace() << "State<MODEL>::toFieldSet starting" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::toFieldSet starting" << std::endl;
   util::Timer timer(classname(), "toFieldSet");
   state_->toFieldSet(fset);
-  Log::trace() << "State<MODEL>::toFieldSet done" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::toFieldSet done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
 void State<MODEL>::print(std::ostream & os) const {
-  Log::trace() << "State<MODEL>::print starting" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::print starting" << std::endl;
   util::Timer timer(classname(), "print");
   os << *state_;
-  Log::trace() << "State<MODEL>::print done" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::print done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
 void State<MODEL>::zero() {
-  Log::trace() << "State<MODEL>::zero starting" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::zero starting" << std::endl;
   util::Timer timer(classname(), "zero");
   fset_.clear();
   state_->zero();
-  Log::trace() << "State<MODEL>::zero done" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::zero done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
 
 template<typename MODEL>
 void State<MODEL>::accumul(const double & zz, const State & xx) {
-  Log::trace() << "State<MODEL>::accumul starting" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::accumul starting" << std::endl;
   util::Timer timer(classname(), "accumul");
   fset_.clear();
   state_->accumul(zz, *xx.state_);
-  Log::trace() << "State<MODEL>::accumul done" << std::endl;
+  OOPS_LOG_TRACE << "State<MODEL>::accumul done" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
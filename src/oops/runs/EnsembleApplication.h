@@ -8,6 +8,8 @@
 #ifndef OOPS_RUNS_ENSEMBLEAPPLICATION_H_
 #define OOPS_RUNS_ENSEMBLEAPPLICATION_H_
 
+#include <algorithm>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -16,6 +18,7 @@
 #include "eckit/mpi/Comm.h"
 #include "oops/mpi/mpi.h"
 #include "oops/runs/Application.h"
+#include "oops/util/LibOOPS.h"
 #include "oops/util/Logger.h"
 #include "oops/util/parameters/Parameter.h"
 #include "oops/util/parameters/Parameters.h"
@@ -33,6 +36,14 @@ class EnsembleApplicationParameters : public ApplicationParameters {
  public:
   /// Parameters containing a list of YAML files for each ensemble member to be processed.
   RequiredParameter<std::vector<std::string>> files{"files", this};
+
+  /// Scheduling of the members on the MPI tasks: "static" runs each member on its own
+  /// communicator, "dynamic" hands members to worker communicators as they become free.
+  Parameter<std::string> scheduling{"scheduling", "static", this};
+
+  /// Number of worker communicators for dynamic scheduling. By default, each MPI task other
+  /// than the coordinator is a worker.
+  Parameter<int> workers{"workers", 0, this};
 };
 
 // -----------------------------------------------------------------------------
@@ -59,6 +70,9 @@ class EnsembleApplication : public Application {
 
     Log::info() << "EnsembleApplication YAML files:" << files << std::endl;
 
+    if (params.scheduling.value() == "dynamic") return executeDynamic(params, validate);
+    ASSERT(params.scheduling.value() == "static");
+
 //  Get the MPI partition
     const int nmembers = files.size();
     const int ntasks = this->getComm().size();
@@ -104,6 +118,119 @@ class EnsembleApplication : public Application {
   }
 // -----------------------------------------------------------------------------
  private:
+/// Task farm: task 0 coordinates and the other tasks are split in worker communicators,
+/// which request the next member from the coordinator each time they are free.
+/// The test output of each member is collected on the first task of its worker and
+/// reported by the coordinator in member order.
+  int executeDynamic(const EnsembleApplicationParameters_ & params, bool validate) const {
+    const eckit::mpi::Comm & comm = this->getComm();
+    const std::vector<std::string> &files = params.files.value();
+    const int nmembers = files.size();
+    const int ntasks = comm.size();
+    const int mytask = comm.rank();
+    ASSERT(ntasks > 1);
+
+//  Get the MPI partition: workers get blocks of contiguous tasks, as evenly as possible
+    const int nworkers = params.workers.value() > 0 ? params.workers.value() : ntasks - 1;
+    ASSERT(nworkers <= ntasks - 1);
+    const int tasks_per_worker = (ntasks - 1) / nworkers;
+    const int nbigger = (ntasks - 1) % nworkers;
+    int myworker = -1;
+    if (mytask > 0) {
+      const int jtask = mytask - 1;
+      if (jtask < nbigger * (tasks_per_worker + 1)) {
+        myworker = jtask / (tasks_per_worker + 1);
+      } else {
+        myworker = nbigger + (jtask - nbigger * (tasks_per_worker + 1)) / tasks_per_worker;
+      }
+    }
+
+    Log::info() << "Running " << nmembers << " EnsembleApplication members handled by "
+                << nworkers << " workers of " << tasks_per_worker << " to "
+                << tasks_per_worker + (nbigger > 0 ? 1 : 0) << " MPI tasks." << std::endl;
+
+//  Create the communicator for each worker, named comm_worker_{i}:
+    const std::string commNameStr = mytask == 0 ? std::string("comm_coordinator")
+                                                : "comm_worker_" + std::to_string(myworker);
+    eckit::mpi::Comm & commWorker = comm.split(myworker + 1, commNameStr.c_str());
+
+    const int tag = 3719;
+    int status = 0;
+    std::vector<std::string> memberTests;
+    std::vector<int> memberIds;
+    if (mytask == 0) {
+//    Coordinator: reply to each request with the next member, or -1 when all are handed out
+      int next = 0;
+      int active = nworkers;
+      while (active > 0) {
+        int result = 0;
+        eckit::mpi::Status st = comm.receive(&result, 1, comm.anySource(), tag);
+        status = std::max(status, result);
+        int member = -1;
+        if (next < nmembers) {
+          member = next++;
+        } else {
+          --active;
+        }
+        comm.send(&member, 1, st.source(), tag);
+      }
+      Log::test() << "EnsembleApplication processed " << nmembers << " members with "
+                  << nworkers << " workers" << std::endl;
+    } else {
+//    Worker: report the result of the previous member and ask for the next one
+      int result = 0;
+      while (true) {
+        int member = -1;
+        if (commWorker.rank() == 0) {
+          comm.send(&result, 1, 0, tag);
+          comm.receive(&member, 1, 0, tag);
+        }
+        commWorker.broadcast(member, 0);
+        if (member < 0) break;
+
+        Log::info() << "EnsembleApplication worker " << myworker << " running member "
+                    << member + 1 << std::endl;
+        const eckit::PathName confPath = files[member];
+        const eckit::YAMLConfiguration memberConf(confPath);
+        const std::vector<std::string> comms = eckit::mpi::listComms();
+        std::stringstream memberTest;
+        eckit::Channel & testChannel = LibOOPS::instance().testChannel();
+        if (commWorker.rank() == 0) testChannel.addStream(memberTest);
+        {
+          APP ensapp(commWorker);
+          result = ensapp.execute(memberConf, validate);
+        }
+        status = std::max(status, result);
+        if (commWorker.rank() == 0) {
+          testChannel.flush();
+          testChannel.reset();
+          memberTests.push_back(memberTest.str());
+          memberIds.push_back(member);
+        }
+
+//      Free the communicators split by the member (with fixed names, e.g. comm_geom_0),
+//      so that the next member run by this worker can create them again
+        for (const std::string & name : eckit::mpi::listComms()) {
+          if (std::find(comms.begin(), comms.end(), name) == comms.end()) {
+            eckit::mpi::deleteComm(name);
+          }
+        }
+      }
+    }
+
+//  Report the test output of the members in member order
+    oops::mpi::allGatherv(comm, memberTests);
+    oops::mpi::allGatherv(comm, memberIds);
+    std::vector<size_t> order(memberIds.size());
+    for (size_t jj = 0; jj < order.size(); ++jj) order[jj] = jj;
+    std::sort(order.begin(), order.end(),
+              [&memberIds](size_t ia, size_t ib) {return memberIds[ia] < memberIds[ib];});
+    for (const size_t jj : order) {
+      Log::test() << "Member " << memberIds[jj] + 1 << ":" << std::endl << memberTests[jj];
+    }
+    return status;
+  }
+// -----------------------------------------------------------------------------
   std::string appname() const override {
     return "oops::EnsembleApplication<>";
   }
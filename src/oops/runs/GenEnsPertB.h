@@ -11,9 +11,13 @@
 #ifndef OOPS_RUNS_GENENSPERTB_H_
 #define OOPS_RUNS_GENENSPERTB_H_
 
+#include <algorithm>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <vector>
+
+#include "eckit/mpi/Comm.h"
 
 #include "oops/base/Geometry.h"
 #include "oops/base/Increment.h"
@@ -31,6 +35,7 @@
 #include "oops/util/DateTime.h"
 #include "oops/util/Duration.h"
 #include "oops/util/Logger.h"
+#include "oops/util/parameters/Parameter.h"
 
 namespace oops {
 
@@ -72,6 +77,10 @@ template <typename MODEL> class GenEnsPertBParameters : public ApplicationParame
   /// Size of the perturbed ensemble to generate.
   RequiredParameter<int> members{"members", this};
 
+  /// Number of groups of MPI tasks running member forecasts concurrently. The tasks are
+  /// split evenly between the groups and members are assigned to the groups in turn.
+  Parameter<int> memberGroups{"member groups", 1, this};
+
   /// Where to write the output.
   RequiredParameter<StateWriterParameters_> output{"output", this};
 };
@@ -105,8 +114,60 @@ template <typename MODEL> class GenEnsPertB : public Application {
     if (validate) params.validate(fullConfig);
     params.deserialize(fullConfig);
 
+//  Split the MPI tasks in groups running member forecasts concurrently
+    const int ngroups = params.memberGroups;
+    const int ntasks = this->getComm().size();
+    ASSERT(ngroups >= 1 && ntasks % ngroups == 0);
+    const int mygroup = this->getComm().rank() / (ntasks / ngroups);
+    const std::string commName = "comm_member_group_" + std::to_string(mygroup);
+    const eckit::mpi::Comm & commGroup =
+        ngroups > 1 ? this->getComm().split(mygroup, commName.c_str()) : this->getComm();
+    if (ngroups > 1) {
+      Log::info() << "Running member forecasts in " << ngroups << " groups of "
+                  << ntasks / ngroups << " MPI tasks" << std::endl;
+    }
+
+//  Run the members of this group, the group communicator is released once all the objects
+//  using it have been destroyed
+    std::vector<std::string> finals;
+    std::vector<int> finalMembers;
+    this->runMembers(params, commGroup, ngroups, mygroup, finals, finalMembers);
+    if (ngroups > 1) eckit::mpi::deleteComm(commName);
+
+//  Print final states in member order
+    if (ngroups > 1) {
+      oops::mpi::allGatherv(this->getComm(), finals);
+      oops::mpi::allGatherv(this->getComm(), finalMembers);
+    }
+    std::vector<size_t> order(finals.size());
+    for (size_t jj = 0; jj < order.size(); ++jj) order[jj] = jj;
+    std::sort(order.begin(), order.end(),
+              [&finalMembers](size_t ia, size_t ib) {return finalMembers[ia] < finalMembers[ib];});
+    for (const size_t jj : order) {
+      Log::test() << "Member " << finalMembers[jj] << " final state: " << finals[jj] << std::endl;
+    }
+
+    return 0;
+  }
+// -----------------------------------------------------------------------------
+  void outputSchema(const std::string & outputPath) const override {
+    GenEnsPertBParameters_ params;
+    params.outputSchema(outputPath);
+  }
+// -----------------------------------------------------------------------------
+  void validateConfig(const eckit::Configuration & fullConfig) const override {
+    GenEnsPertBParameters_ params;
+    params.validate(fullConfig);
+  }
+// -----------------------------------------------------------------------------
+ private:
+/// Generates the perturbed members of group \p mygroup and runs their forecasts. The
+/// printout of each final state is returned, on the first task of the group only.
+  void runMembers(const GenEnsPertBParameters_ & params, const eckit::mpi::Comm & commGroup,
+                  const int ngroups, const int mygroup, std::vector<std::string> & finals,
+                  std::vector<int> & finalMembers) const {
 //  Setup resolution
-    const Geometry_ resol(params.geometry, this->getComm(), oops::mpi::myself());
+    const Geometry_ resol(params.geometry, commGroup, oops::mpi::myself());
 
 //  Setup Model
     const Model_ model(resol, params.model.value().modelParameters);
@@ -133,15 +194,37 @@ template <typename MODEL> class GenEnsPertB : public Application {
     std::unique_ptr<CovarianceBase_> Bmat(CovarianceFactory_::create(
                                             resol, vars, covarParams, xx, xx));
 
-//  Generate perturbed states
+//  Printout of a final state, made on every task of the group since printing can be
+//  collective for some models, kept on the first task of the group
+    auto keepFinal = [&](const State_ & xf, const int jm) {
+      std::stringstream ss;
+      ss.setf(Log::test().flags());
+      ss.precision(Log::test().precision());
+      ss << xf;
+      if (commGroup.rank() == 0) {
+        finals.push_back(ss.str());
+        finalMembers.push_back(jm);
+      }
+    };
+
+//  Generate perturbed states. Every group draws all perturbations in the same order,
+//  so that members do not depend on the number of groups, and runs its own members.
+//  Each member is perturbed, run, written and printed before the next one is generated,
+//  unless the model steps all members together.
     Increment_ dx(resol, vars, bgndate);
+    const bool batched = model.hasBatchedStep();
+    std::vector<std::unique_ptr<State_>> members;
+    std::vector<State_ *> xps;
+    std::vector<PostProcessor<State_>> posts;
+    std::vector<int> mymembers;
     for (int jm = 0; jm < params.members; ++jm) {
 //    Generate pertubation
       Bmat->randomize(dx);
+      if (jm % ngroups != mygroup) continue;
 
 //    Add mean state
-      State_ xp(xx);
-      xp += dx;
+      std::unique_ptr<State_> xp(new State_(xx));
+      *xp += dx;
 
 //    Setup forecast outputs
       PostProcessor<State_> post;
@@ -151,25 +234,23 @@ template <typename MODEL> class GenEnsPertB : public Application {
 
       post.enrollProcessor(new StateWriter<State_>(outParams));
 
-//    Run forecast
-      model.forecast(xp, moderr, fclength, post);
-      Log::test() << "Member " << jm << " final state: " << xp << std::endl;
+//    Run forecast now, or with all members of the group when the model steps them together
+      if (batched) {
+        xps.push_back(xp.get());
+        posts.push_back(post);
+        members.push_back(std::move(xp));
+        mymembers.push_back(jm);
+      } else {
+        model.forecast(*xp, moderr, fclength, post);
+        keepFinal(*xp, jm);
+      }
+    }
+    if (batched && !xps.empty()) {
+      model.forecastEnsemble(xps, moderr, fclength, posts);
+      for (size_t jj = 0; jj < members.size(); ++jj) keepFinal(*members[jj], mymembers[jj]);
     }
-
-    return 0;
-  }
-// -----------------------------------------------------------------------------
-  void outputSchema(const std::string & outputPath) const override {
-    GenEnsPertBParameters_ params;
-    params.outputSchema(outputPath);
-  }
-// -----------------------------------------------------------------------------
-  void validateConfig(const eckit::Configuration & fullConfig) const override {
-    GenEnsPertBParameters_ params;
-    params.validate(fullConfig);
   }
 // -----------------------------------------------------------------------------
- private:
   std::string appname() const override {
     return "oops::GenEnsPertB<" + MODEL::name() + ">";
   }
@@ -192,6 +192,8 @@ eckit::Channel& LibOOPS::traceChannel() const {
       new eckit::PrefixTarget(pretrace_, new eckit::OStreamTarget(eckit::Log::info()))));
   } else {
     traceChannel_.reset(new eckit::Channel());
+    // Nothing is formatted into a stream in a failed state
+    traceChannel_->setstate(std::ios::badbit);
   }
   return *traceChannel_;
 }
@@ -232,6 +234,7 @@ eckit::Channel& LibOOPS::debugChannel() const {
     debugChannel_.reset(new eckit::Channel(new eckit::PrefixTarget(predebug_)));
   } else {
     debugChannel_.reset(new eckit::Channel());
+    debugChannel_->setstate(std::ios::badbit);
   }
   return *debugChannel_;
 }
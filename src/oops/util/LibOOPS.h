@@ -43,6 +43,9 @@ class LibOOPS : public eckit::system::Library {
   eckit::Channel& statsChannel() const;
   eckit::Channel& testChannel() const;
 
+  bool traceEnabled() const {return trace_;}
+  bool debugEnabled() const {return debug_;}
+
   void initialise();
   void testReferenceInitialise(const eckit::LocalConfiguration &);
   void teeOutput(const std::string &);
@@ -28,10 +28,20 @@ struct Log {
   static std::ostream& trace() {return LibOOPS::instance().traceChannel();}  // prefix "OOPS_TRACE"
   static std::ostream& stats() {return LibOOPS::instance().statsChannel();}  // prefix "OOPS_STATS"
   static std::ostream& test()  {return LibOOPS::instance().testChannel();}   // prefix "Test     :"
+
+  static bool traceEnabled() {return LibOOPS::instance().traceEnabled();}
+  static bool debugEnabled() {return LibOOPS::instance().debugEnabled();}
 };
 
 // -----------------------------------------------------------------------------
 
+// Trace and debug output whose arguments are not evaluated at all when the channel is off,
+// for use in frequently called methods:  OOPS_LOG_TRACE << "Class::method" << std::endl;
+#define OOPS_LOG_TRACE if (!::oops::Log::traceEnabled()) {} else ::oops::Log::trace()
+#define OOPS_LOG_DEBUG if (!::oops::Log::debugEnabled()) {} else ::oops::Log::debug()
+
+// -----------------------------------------------------------------------------
+
 }  // namespace oops
 
 #endif  // OOPS_UTIL_LOGGER_H_
@@ -138,6 +138,60 @@ void testConfCtor() {
   }
 }
 
+// -----------------------------------------------------------------------------
+void testSchedule() {
+  const util::DateTime winbgn("2020-01-01T00:00:00Z");
+  const util::DateTime winend("2020-01-02T00:00:00Z");
+  const util::Duration step("PT1H");
+  util::DateTime next;
+
+  // default timer: every time in the window is an event
+  oops::PostTimer timer1;
+  timer1.initialize(winbgn, winend);
+  EXPECT(timer1.nextEvent(next));
+  EXPECT(next == winbgn);
+
+  // frequency and steps are merged in one schedule
+  eckit::LocalConfiguration test1;
+  test1.set("frequency", (step*6).toString());
+  std::vector<std::string> steps{"2020-01-01T08:00:00Z", "2020-01-01T04:00:00Z",
+                                 "2020-01-01T12:00:00Z", "2020-01-03T00:00:00Z"};
+  test1.set("steps", steps);
+  oops::PostTimer timer2(oops::validateAndDeserialize<oops::PostTimerParameters>(test1));
+  timer2.initialize(winbgn, winend);
+  const std::vector<util::DateTime> expected{winbgn, winbgn+step*4, winbgn+step*6,
+                                             winbgn+step*8, winbgn+step*12,
+                                             winbgn+step*18, winend};
+  EXPECT(timer2.nextEvent(next));
+  EXPECT(next == winbgn);
+
+  // forward in time
+  size_t jev = 0;
+  for (util::DateTime now(winbgn); now <= winend; now += step) {
+    const bool doit = timer2.itIsTime(now);
+    EXPECT(doit == (now == expected[jev]));
+    if (doit) ++jev;
+    if (jev < expected.size()) {
+      EXPECT(timer2.nextEvent(next));
+      EXPECT(next == expected[jev]);
+    } else {
+      EXPECT(!timer2.nextEvent(next));
+    }
+  }
+  EXPECT(jev == expected.size());
+
+  // backward in time (as in adjoint runs)
+  jev = 0;
+  for (util::DateTime now(winend); now >= winbgn; now -= step) {
+    const bool doit = timer2.itIsTime(now);
+    EXPECT(doit == (now == expected[expected.size() - 1 - jev]));
+    if (doit) ++jev;
+  }
+  EXPECT(jev == expected.size());
+  EXPECT(!timer2.itIsTime(util::DateTime("2020-01-03T00:00:00Z")));
+}
+
+// -----------------------------------------------------------------------------
 class PostTimer : public oops::Test {
  private:
   std::string testid() const override {return "test::PostTimer";}
@@ -154,6 +208,9 @@ class PostTimer : public oops::Test {
     ts.emplace_back(CASE("util/PostTimer/confCtor") {
                       testConfCtor();
                     });
+    ts.emplace_back(CASE("util/PostTimer/schedule") {
+                      testSchedule();
+                    });
   }
 
   void clear() const override {}
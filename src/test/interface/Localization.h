@@ -118,6 +118,33 @@ template <typename MODEL> void testLocalizationMultiply() {
 
 // -----------------------------------------------------------------------------
 
+template <typename MODEL> void testLocalizationMultiplyEnsemble() {
+  typedef LocalizationFixture<MODEL> Test_;
+  typedef oops::Increment<MODEL>     Increment_;
+
+  const size_t nmembers = 3;
+  std::vector<Increment_> dxs;
+  std::vector<Increment_> dxref;
+  for (size_t jm = 0; jm < nmembers; ++jm) {
+    dxs.emplace_back(Test_::resol(), Test_::ctlvars(), Test_::time());
+    dxs.back().random();
+    dxs.back() *= static_cast<double>(jm + 1);
+    dxref.emplace_back(dxs.back());
+    Test_::localization().multiply(dxref.back());
+  }
+
+  // Localizing all members at once should give the same result as one at a time
+  Test_::localization().multiplyEnsemble(dxs);
+  for (size_t jm = 0; jm < nmembers; ++jm) {
+    const double ref = dxref[jm].norm();
+    EXPECT(ref > 0.0);
+    dxs[jm] -= dxref[jm];
+    EXPECT(dxs[jm].norm() <= 1.0e-12 * ref);
+  }
+}
+
+// -----------------------------------------------------------------------------
+
 template <typename MODEL> class Localization : public oops::Test {
  public:
   Localization() {}
@@ -134,6 +161,8 @@ template <typename MODEL> class Localization : public oops::Test {
       { testLocalizationZero<MODEL>(); });
     ts.emplace_back(CASE("interface/Localization/testLocalizationMultiply")
       { testLocalizationMultiply<MODEL>(); });
+    ts.emplace_back(CASE("interface/Localization/testLocalizationMultiplyEnsemble")
+      { testLocalizationMultiplyEnsemble<MODEL>(); });
   }
 
   void clear() const override {}